@@ -0,0 +1,176 @@
+// Header files
+#include <stdlib.h>
+
+#include "Arena.h"
+
+// Rounds a size up to the arena alignment
+#define ALIGN_SIZE(size) (((size) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+struct SlabObject
+{
+    struct SlabObject *next;
+};
+
+/**
+ * @brief Initializes an empty arena.
+ *
+ * @param[out] arena Arena to initialize
+ */
+void initArena(Arena *arena)
+{
+    arena->blocks = NULL;
+    arena->nextFree = NULL;
+    arena->bytesLeft = 0;
+    pthread_mutex_init(&arena->lock, NULL);
+}
+
+/**
+ * @brief Allocates bytes from the arena.
+ *
+ * @details Bumps a pointer through the current block, starting a new
+ *          block when the request does not fit. Requests larger than a
+ *          block get a block of their own. O(1).
+ *
+ * @param[in] arena Arena
+ *
+ * @param[in] size Bytes needed
+ *
+ * @return void Uninitialized memory, aligned to ARENA_ALIGNMENT, valid
+ *              until clearArena
+ */
+void *arenaAlloc(Arena *arena, size_t size)
+{
+    size_t headerSize = ALIGN_SIZE(sizeof(ArenaBlock));
+    size_t blockSize;
+    ArenaBlock *block;
+    void *object;
+
+    size = ALIGN_SIZE(size);
+
+    pthread_mutex_lock(&arena->lock);
+    if (size > arena->bytesLeft)
+    {
+        blockSize = (size > ARENA_BLOCK_SIZE - headerSize) ? headerSize + size : ARENA_BLOCK_SIZE;
+        block = (ArenaBlock *)malloc(blockSize);
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->nextFree = (char *)block + headerSize;
+        arena->bytesLeft = blockSize - headerSize;
+    }
+
+    object = arena->nextFree;
+    arena->nextFree += size;
+    arena->bytesLeft -= size;
+    pthread_mutex_unlock(&arena->lock);
+
+    return object;
+}
+
+/**
+ * @brief Releases everything allocated from the arena.
+ *
+ * @details Frees the block chain, one free per block rather than per
+ *          object. Slab caches on the arena must be reset before reuse.
+ *
+ * @param[in] arena Arena
+ */
+void clearArena(Arena *arena)
+{
+    ArenaBlock *block = arena->blocks;
+    ArenaBlock *next;
+
+    while (block != NULL)
+    {
+        next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->blocks = NULL;
+    arena->nextFree = NULL;
+    arena->bytesLeft = 0;
+}
+
+/**
+ * @brief Initializes an empty slab cache.
+ *
+ * @param[out] cache Cache to initialize
+ *
+ * @param[in] arena Arena objects are carved from
+ *
+ * @param[in] objectSize Size of one object
+ */
+void initSlabCache(SlabCache *cache, Arena *arena, size_t objectSize)
+{
+    cache->arena = arena;
+    cache->objectSize = objectSize;
+    cache->freeList = NULL;
+}
+
+/**
+ * @brief Allocates one object.
+ *
+ * @details Pops the free list, or carves a new object from the arena
+ *          when it is empty. Pops hold the arena lock, so there is only
+ *          ever one popper and the free list needs no ABA protection.
+ *          O(1).
+ *
+ * @param[in] cache Slab cache
+ *
+ * @return void Uninitialized object
+ */
+void *slabAlloc(SlabCache *cache)
+{
+    struct SlabObject *object;
+    struct SlabObject *next;
+
+    pthread_mutex_lock(&cache->arena->lock);
+    object = __atomic_load_n(&cache->freeList, __ATOMIC_ACQUIRE);
+    while (object != NULL)
+    {
+        next = object->next;
+        if (__atomic_compare_exchange_n(&cache->freeList, &object, next, 1,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&cache->arena->lock);
+
+    if (object == NULL)
+    {
+        return arenaAlloc(cache->arena, cache->objectSize);
+    }
+    return object;
+}
+
+/**
+ * @brief Returns an object to its cache.
+ *
+ * @details Pushes the object on the free list with a compare-and-swap
+ *          loop, so any thread may free without taking a lock. O(1).
+ *
+ * @param[in] cache Slab cache the object came from
+ *
+ * @param[in] object Object no longer in use
+ */
+void slabFree(SlabCache *cache, void *object)
+{
+    struct SlabObject *freed = (struct SlabObject *)object;
+
+    freed->next = __atomic_load_n(&cache->freeList, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&cache->freeList, &freed->next, freed, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+        // freed->next was refreshed with the current head, try again
+    }
+}
+
+/**
+ * @details Forgets the free list, whose objects went with the arena.
+ *
+ * @param[in] cache Slab cache on a cleared arena
+ */
+void resetSlabCache(SlabCache *cache)
+{
+    cache->freeList = NULL;
+}
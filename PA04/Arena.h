@@ -0,0 +1,59 @@
+// Pre-compiler directive
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <pthread.h>
+#include <stddef.h>
+
+// Bytes reserved from the OS at a time
+#define ARENA_BLOCK_SIZE 65536
+
+// Every allocation is rounded up to a multiple of this
+#define ARENA_ALIGNMENT 16
+
+// Block header, the block's bytes follow it
+typedef struct ArenaBlock
+{
+    struct ArenaBlock *next;
+} ArenaBlock;
+
+// Bump allocator over a chain of blocks
+// Objects are never freed one at a time; clearArena returns every block
+// at once. The lock makes allocation safe from any thread
+typedef struct
+{
+    ArenaBlock *blocks;
+    char *nextFree;
+    size_t bytesLeft;
+    pthread_mutex_t lock;
+} Arena;
+
+// Static initializer for an empty arena
+#define ARENA_INITIALIZER { NULL, NULL, 0, PTHREAD_MUTEX_INITIALIZER }
+
+// Free list link, stored in the first bytes of a freed object
+struct SlabObject;
+
+// Cache of one fixed-size object type carved from an arena
+// Freed objects are kept on a free list and handed out again before the
+// arena is asked for more
+typedef struct
+{
+    Arena *arena;
+    size_t objectSize;
+    struct SlabObject *freeList;
+} SlabCache;
+
+// Static initializer for an empty cache of objectSize byte objects
+#define SLAB_CACHE_INITIALIZER(arena, objectSize) { (arena), (objectSize), NULL }
+
+// Function Prototypes
+void initArena(Arena *arena);
+void *arenaAlloc(Arena *arena, size_t size);
+void clearArena(Arena *arena);
+void initSlabCache(SlabCache *cache, Arena *arena, size_t objectSize);
+void *slabAlloc(SlabCache *cache);
+void slabFree(SlabCache *cache, void *object);
+void resetSlabCache(SlabCache *cache);
+
+#endif // ARENA_H
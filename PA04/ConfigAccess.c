@@ -1,5 +1,91 @@
 // header files
 #include "ConfigAccess.h"
+#include "KeywordTable.h"
+
+// keyword tables, generated by KeywordSeed.py
+    // Note: each seed places every keyword in its own slot, so adding a
+    //       keyword means searching for a new seed: add its entry to an
+    //       empty slot and run python3 KeywordSeed.py ConfigAccess.c
+    //       <table> -w, table being configPrompt, cpuSched, logTo, or
+    //       clockMode
+
+// config line prompts
+static const KeywordEntry configPromptSlots[ 32 ] =
+{
+    { "Fair Target Latency (msec)", CFG_FAIR_LATENCY_CODE },
+    { NULL, 0 },
+    { "Memory Available (KB)", CFG_MEM_AVAILABLE_CODE },
+    { NULL, 0 },
+    { "Processor Cycle Time (msec)", CFG_PROC_CYCLES_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "CPU Scheduling Code", CFG_CPU_SCHED_CODE },
+    { NULL, 0 },
+    { "Fair Minimum Granularity (msec)", CFG_FAIR_GRANULARITY_CODE },
+    { "Clock Mode", CFG_CLOCK_MODE_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "Priority Aging Time (msec)", CFG_PRIORITY_AGING_CODE },
+    { NULL, 0 },
+    { "Log File Path", CFG_LOG_FILE_NAME_CODE },
+    { "I/O Cycle Time (msec)", CFG_IO_CYCLES_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "Quantum Time (cycles)", CFG_QUANT_CYCLES_CODE },
+    { "File Path", CFG_MD_FILE_NAME_CODE },
+    { "MLFQ Quantum Times (cycles)", CFG_MLFQ_QUANTA_CODE },
+    { "Log To", CFG_LOG_TO_CODE },
+    { "MLFQ Boost Time (msec)", CFG_MLFQ_BOOST_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "MLFQ Levels", CFG_MLFQ_LEVELS_CODE },
+    { "Version/Phase", CFG_VERSION_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 }
+};
+static const KeywordTable configPromptTable = { configPromptSlots, 32, 22, False };
+
+// cpu scheduling names, matched without case
+static const KeywordEntry cpuSchedSlots[ 16 ] =
+{
+    { "fcfs-p", CPU_SCHED_FCFS_P_CODE },
+    { "stride-p", CPU_SCHED_STRIDE_P_CODE },
+    { "priority-n", CPU_SCHED_PRIORITY_N_CODE },
+    { "lottery-p", CPU_SCHED_LOTTERY_P_CODE },
+    { NULL, 0 },
+    { "mlfq-p", CPU_SCHED_MLFQ_P_CODE },
+    { NULL, 0 },
+    { "rr-p", CPU_SCHED_RR_P_CODE },
+    { "priority-p", CPU_SCHED_PRIORITY_P_CODE },
+    { "sjf-n", CPU_SCHED_SJF_N_CODE },
+    { "fcfs-n", CPU_SCHED_FCFS_N_CODE },
+    { NULL, 0 },
+    { "edf-p", CPU_SCHED_EDF_P_CODE },
+    { "none", CPU_SCHED_FCFS_N_CODE },
+    { "fair-p", CPU_SCHED_FAIR_P_CODE },
+    { "srtf-p", CPU_SCHED_SRTF_P_CODE }
+};
+static const KeywordTable cpuSchedTable = { cpuSchedSlots, 16, 649, True };
+
+// log to names, matched without case
+static const KeywordEntry logToSlots[ 4 ] =
+{
+    { NULL, 0 },
+    { "file", LOGTO_FILE_CODE },
+    { "monitor", LOGTO_MONITOR_CODE },
+    { "both", LOGTO_BOTH_CODE }
+};
+static const KeywordTable logToTable = { logToSlots, 4, 2, True };
+
+// clock mode names, matched without case
+static const KeywordEntry clockModeSlots[ 2 ] =
+{
+    { "real", CLOCK_REAL_CODE },
+    { "virtual", CLOCK_VIRTUAL_CODE }
+};
+static const KeywordTable clockModeTable = { clockModeSlots, 2, 1, True };
 
 /*
 Function name:  getConfigData
@@ -30,6 +116,7 @@ int getConfigData(char *fileName, ConfigDataType **configData)
     int dataLineCode;   // line leader number code
     int intData;
     double doubleData;
+    long filePosition;
 
     // initilialize config data pointer in case of return error
     *configData = NULL;
@@ -53,12 +140,30 @@ int getConfigData(char *fileName, ConfigDataType **configData)
 
     tempData = (ConfigDataType *) malloc(sizeof(ConfigDataType));
 
-    while(lineCtr < NUM_DATA_LINES)
+    // optional lines default to the original simulator behavior
+    tempData->clockCode = CLOCK_REAL_CODE;
+    tempData->mlfqLevels = MLFQ_DEFAULT_LEVELS;
+    tempData->mlfqQuantaCount = 0;
+    tempData->mlfqBoostTime = MLFQ_DEFAULT_BOOST_TIME;
+    tempData->priorityAgingTime = PRIORITY_DEFAULT_AGING_TIME;
+    tempData->fairLatency = FAIR_DEFAULT_LATENCY;
+    tempData->fairGranularity = FAIR_DEFAULT_GRANULARITY;
+
+    // loop until all required lines are found, then keep accepting
+    // optional lines until the end descriptor is reached
+    while(True)
     {
+        filePosition = ftell(fileAccessPtr);
+
         // get line leader (e.g., file path)
         if(getLineTo(fileAccessPtr, MAX_STR_LEN, COLON,
                                     dataBuffer, IGNORE_LEADING_WS) != NO_ERR )
         {
+            if(lineCtr >= NUM_DATA_LINES)
+            {
+                fseek(fileAccessPtr, filePosition, SEEK_SET);
+                break;
+            }
             free(tempData);
             fclose(fileAccessPtr);
             return INCOMPLETE_FILE_ERR;
@@ -66,6 +171,13 @@ int getConfigData(char *fileName, ConfigDataType **configData)
         // get data line by number in enum
         dataLineCode = getDataLineCode(dataBuffer);
 
+        // not a prompt after all required lines, leave it for end descriptor
+        if(dataLineCode == CFG_CORRUPT_PROMPT_ERR && lineCtr >= NUM_DATA_LINES)
+        {
+            fseek(fileAccessPtr, filePosition, SEEK_SET);
+            break;
+        }
+
         // check data line found
         if(dataLineCode != CFG_CORRUPT_PROMPT_ERR)
         {
@@ -78,7 +190,9 @@ int getConfigData(char *fileName, ConfigDataType **configData)
             else if( (dataLineCode == CFG_MD_FILE_NAME_CODE)
                             || (dataLineCode == CFG_LOG_FILE_NAME_CODE)
                             || (dataLineCode == CFG_CPU_SCHED_CODE)
-                            || (dataLineCode == CFG_LOG_TO_CODE) )
+                            || (dataLineCode == CFG_LOG_TO_CODE)
+                            || (dataLineCode == CFG_CLOCK_MODE_CODE)
+                            || (dataLineCode == CFG_MLFQ_QUANTA_CODE) )
             {
                 fscanf(fileAccessPtr, "%s", dataBuffer);
             }
@@ -128,6 +242,35 @@ int getConfigData(char *fileName, ConfigDataType **configData)
                     case CFG_LOG_FILE_NAME_CODE:
                         copyString(tempData->logToFileName, dataBuffer);
                         break;
+
+                    case CFG_CLOCK_MODE_CODE:
+                        tempData->clockCode = getClockModeCode(dataBuffer);
+                        break;
+
+                    case CFG_MLFQ_LEVELS_CODE:
+                        tempData->mlfqLevels = intData;
+                        break;
+
+                    case CFG_MLFQ_QUANTA_CODE:
+                        tempData->mlfqQuantaCount = getQuantumList(dataBuffer,
+                                                        tempData->mlfqQuanta);
+                        break;
+
+                    case CFG_MLFQ_BOOST_CODE:
+                        tempData->mlfqBoostTime = intData;
+                        break;
+
+                    case CFG_PRIORITY_AGING_CODE:
+                        tempData->priorityAgingTime = intData;
+                        break;
+
+                    case CFG_FAIR_LATENCY_CODE:
+                        tempData->fairLatency = intData;
+                        break;
+
+                    case CFG_FAIR_GRANULARITY_CODE:
+                        tempData->fairGranularity = intData;
+                        break;
                 }
             }
             // data value not in range
@@ -146,7 +289,11 @@ int getConfigData(char *fileName, ConfigDataType **configData)
             return CFG_CORRUPT_PROMPT_ERR;
         }
 
-        lineCtr++;
+        // only required lines count toward the complete file
+        if(dataLineCode < CFG_CLOCK_MODE_CODE)
+        {
+            lineCtr++;
+        }
     }
 
     // Check for end of sim config string
@@ -160,6 +307,9 @@ int getConfigData(char *fileName, ConfigDataType **configData)
         return CFG_CORRUPT_DESCRIPTOR_ERR;
     }
 
+    // levels without a listed quantum double the one above them
+    setMlfqQuanta(tempData);
+
     *configData = tempData;
 
     fclose(fileAccessPtr);
@@ -168,7 +318,7 @@ int getConfigData(char *fileName, ConfigDataType **configData)
 
 /*
 Function name:  getDataLineCode
-Algorithm:      tests string for one of known leader string, returns line number
+Algorithm:      looks up string in the prompt hash table, returns line number
                 if string is correct, returns CFG_CORRUPT_DATA_ERR if string
                 is not found
 Precondition:   dataBuffer is valid C-Style string
@@ -179,82 +329,21 @@ Notes: none
  */
 int getDataLineCode( char *dataBuffer )
 {
-    // return appropriate code depending on prompt string provided
-
-    // check for version/phase string
-        // func: compareString
-    if( compareString( dataBuffer, "Version/Phase" ) == STR_EQ )
-    {
-        // return configuration version code
-        return CFG_VERSION_CODE;
-    }
-
-    // check for file path string
-        // func: compareString
-    if( compareString( dataBuffer, "File Path" ) == STR_EQ )
-    {
-        // return meta data file path code
-        return CFG_MD_FILE_NAME_CODE;
-    }
-
-    // check for cpu scheduling code string
-        // func: compareString
-    if( compareString( dataBuffer, "CPU Scheduling Code" ) == STR_EQ )
-    {
-        // return cpu schedule code code
-        return CFG_CPU_SCHED_CODE;
-    }
-
-    // check for quantum time string
-        // func: compareString
-    if( compareString( dataBuffer, "Quantum Time (cycles)" ) == STR_EQ )
-    {
-        // return quantum cycles code
-        return CFG_QUANT_CYCLES_CODE;
-    }
-
-    // check for memory available string
-        // func: compareString
-    if( compareString( dataBuffer, "Memory Available (KB)" ) == STR_EQ )
-    {
-        // return memory available code
-        return CFG_MEM_AVAILABLE_CODE;
-    }
-
-    // check for processor cycle time string
-        // func: compareString
-    if( compareString( dataBuffer, "Processor Cycle Time (msec)" ) == STR_EQ )
-    {
-        // return processor cycle code
-        return CFG_PROC_CYCLES_CODE;
-    }
-
-    // check for I/O cycle time string
-        // func: compareString
-    if( compareString( dataBuffer, "I/O Cycle Time (msec)" ) == STR_EQ )
-    {
-        // return I/O cycles code
-        return CFG_IO_CYCLES_CODE;
-    }
+    // initialize function/variables
 
-    // check for log to string
-        // func: compareString
-    if( compareString( dataBuffer, "Log To" ) == STR_EQ )
-    {
-        // return log to code
-        return CFG_LOG_TO_CODE;
-    }
+        // look up prompt string
+            // func: lookupKeyword
+        int lineCode = lookupKeyword( &configPromptTable, dataBuffer );
 
-    // check for log file path string
-        // func: compareString
-    if( compareString( dataBuffer, "Log File Path" ) == STR_EQ )
+    // check for unknown prompt
+    if( lineCode == KEYWORD_NOT_FOUND )
     {
-        // return log to file name code
-        return CFG_LOG_FILE_NAME_CODE;
+        // return corrupt prompt error
+        return CFG_CORRUPT_PROMPT_ERR;
     }
 
-    // at this point, assume failed string access, return corrupt prompt error
-    return CFG_CORRUPT_PROMPT_ERR;
+    // return line code found
+    return lineCode;
 }
 
 /*
@@ -271,56 +360,19 @@ ConfigDataCodes getCpuSchedCode( char *codeStr )
 {
     // initialize function/variables
 
-        // set up temporary string for testing
-            //func: getStringLength, malloc
-        int strLen = getStringLength( codeStr );
-        char *tempStr = (char *)malloc( strLen + 1 );
-
-        // set default return to FCFS-N
-        int returnVal = CPU_SCHED_FCFS_N_CODE;
-
-    // set string to lower case for testing
-        //func: setStrToLowerCase
-    setStrToLowerCase( tempStr, codeStr );
-
-    // check for SJF-N
-        // function: compareString
-    if( compareString( tempStr, "sjf-n" ) == STR_EQ )
-    {
-        // set return to SJF-N code
-        returnVal = CPU_SCHED_SJF_N_CODE;
-    }
-
-    // check for SRTF-P
-        // func: compareString
-    if( compareString( tempStr, "srtf-p" ) == STR_EQ )
-    {
-        // set return to SRTF-P code
-        return CPU_SCHED_SRTF_P_CODE;
-    }
-
-    // check for FCFS-P
-        // func: compareString
-    if( compareString( tempStr, "fcfs-p" ) == STR_EQ )
-    {
-        // set return to FCFS-P code
-        return  CPU_SCHED_FCFS_P_CODE;
-    }
+        // look up scheduling name, case is ignored
+            // func: lookupKeyword
+        int returnVal = lookupKeyword( &cpuSchedTable, codeStr );
 
-    // check for RR-P
-        // func: compareString
-    if( compareString( tempStr, "rr-p" ) == STR_EQ )
+    // check for unknown name
+    if( returnVal == KEYWORD_NOT_FOUND )
     {
-        // set return to RR-P code
-        return CPU_SCHED_RR_P_CODE;
+        // set default return to FCFS-N
+        returnVal = CPU_SCHED_FCFS_N_CODE;
     }
 
-    // free temp str memory
-        // func: free
-    free( tempStr );
-
     // return code found
-    return returnVal;   // temp stub return
+    return returnVal;
 }
 
 /*
@@ -337,8 +389,7 @@ Notes: none
 Boolean valueInRange(int lineCode, int intVal, double doubleVal, char *stringVal)
 {
     Boolean result = True;
-    char *tempStr;
-    int strLen;
+    int quantumList[ MLFQ_MAX_LEVELS ];
 
     switch(lineCode)
     {
@@ -350,20 +401,10 @@ Boolean valueInRange(int lineCode, int intVal, double doubleVal, char *stringVal
             break;
 
         case CFG_CPU_SCHED_CODE:
-            strLen = getStringLength(stringVal);
-            tempStr = (char *)malloc(strLen + 1);
-            setStrToLowerCase(tempStr, stringVal);
-
-            if( (compareString(tempStr, "none") != STR_EQ)
-                    && (compareString(tempStr, "fcfs-n") != STR_EQ)
-                    && (compareString(tempStr, "sjf-n") != STR_EQ)
-                    && (compareString(tempStr, "srtf-p") != STR_EQ)
-                    && (compareString(tempStr, "fcfs-p") != STR_EQ)
-                    && (compareString(tempStr, "rr-p") != STR_EQ) )
+            if(lookupKeyword(&cpuSchedTable, stringVal) == KEYWORD_NOT_FOUND)
             {
                 result = False;
             }
-            free(tempStr);
             break;
 
         case CFG_QUANT_CYCLES_CODE:
@@ -395,22 +436,142 @@ Boolean valueInRange(int lineCode, int intVal, double doubleVal, char *stringVal
             break;
 
         case CFG_LOG_TO_CODE:
-            strLen = getStringLength(stringVal);
-            tempStr = (char *)malloc(strLen + 1);
-            setStrToLowerCase(tempStr, stringVal);
+            if(lookupKeyword(&logToTable, stringVal) == KEYWORD_NOT_FOUND)
+            {
+                result = False;
+            }
+            break;
 
-            if( (compareString(tempStr, "both") != STR_EQ)
-                    && (compareString(tempStr, "monitor") != STR_EQ)
-                    && (compareString(tempStr, "file") != STR_EQ) )
+        case CFG_CLOCK_MODE_CODE:
+            if(lookupKeyword(&clockModeTable, stringVal) == KEYWORD_NOT_FOUND)
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_MLFQ_LEVELS_CODE:
+            if(intVal < 1 || intVal > MLFQ_MAX_LEVELS)
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_MLFQ_QUANTA_CODE:
+            if(getQuantumList(stringVal, quantumList) == 0)
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_MLFQ_BOOST_CODE:
+        case CFG_PRIORITY_AGING_CODE:
+            if(intVal < 0 || intVal > 1000000)
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_FAIR_LATENCY_CODE:
+        case CFG_FAIR_GRANULARITY_CODE:
+            if(intVal < 1 || intVal > 1000000)
             {
                 result = False;
             }
-            free(tempStr);
             break;
     }
     return result;
 }
 
+/*
+Function name:  getQuantumList
+Algorithm:      reads comma separated quantum cycle counts, one per
+                MLFQ level from the top
+Precondition:   quantumStr is a C-Style string, e.g. "2,4,8"
+Postcondition:  quanta holds each count read, in order
+Exceptions:     returns 0 if a count is missing, not a number, outside
+                1 to 100, or there are more than MLFQ_MAX_LEVELS counts
+Notes: none
+ */
+int getQuantumList( char *quantumStr, int *quanta )
+{
+    // initialize function/variables
+    int count = 0;
+    int index = 0;
+    int value;
+
+    // loop across the list, one count per pass
+    while( count < MLFQ_MAX_LEVELS )
+    {
+        // read digits up to the next comma or end of string
+        value = 0;
+        if( quantumStr[ index ] < '0' || quantumStr[ index ] > '9' )
+        {
+            return 0;
+        }
+        while( quantumStr[ index ] >= '0' && quantumStr[ index ] <= '9'
+                                                          && value <= 100 )
+        {
+            value = value * 10 + ( quantumStr[ index ] - '0' );
+            index++;
+        }
+        if( value < 1 || value > 100 )
+        {
+            return 0;
+        }
+        quanta[ count ] = value;
+        count++;
+
+        // check for end of list
+        if( quantumStr[ index ] == NULL_CHAR )
+        {
+            return count;
+        }
+
+        // anything other than a comma is out of range
+        if( quantumStr[ index ] != COMMA )
+        {
+            return 0;
+        }
+        index++;
+    }
+
+    // too many levels listed
+    return 0;
+}
+
+/*
+Function name:  setMlfqQuanta
+Algorithm:      fills the quantum of every MLFQ level not listed in the
+                config file, doubling the quantum of the level above; with
+                no list, the top level uses the round robin quantum
+Precondition:   config data is read, mlfqQuantaCount is the number of
+                listed quanta
+Postcondition:  mlfqQuanta holds a quantum of at least one cycle for each
+                of the mlfqLevels levels
+Exceptions:     none
+Notes: none
+ */
+void setMlfqQuanta( ConfigDataType *configData )
+{
+    // initialize function/variables
+    int level = configData->mlfqQuantaCount;
+
+    // start from the round robin quantum when no list was given
+    if( level == 0 )
+    {
+        configData->mlfqQuanta[ 0 ] = ( configData->quantumCycles > 0 )
+                                            ? configData->quantumCycles : 1;
+        level = 1;
+    }
+
+    // double the quantum for each lower level
+    while( level < configData->mlfqLevels )
+    {
+        configData->mlfqQuanta[ level ] = configData->mlfqQuanta[ level - 1 ] * 2;
+        level++;
+    }
+}
+
 /*
 Function name:  getLogToCode
 Algorithm:      converts string data (e.g., "file", "Monitor") to constant
@@ -425,38 +586,46 @@ ConfigDataCodes getLogToCode( char *logToStr )
 {
     // intialize func/variables
 
-        // create temp str
-            // func: getStringLength, malloc
-        int strLen = getStringLength( logToStr );
-        char *tempStr = (char *)malloc( strLen + 1 );
+        // look up log to name, case is ignored
+            // func: lookupKeyword
+        int returnVal = lookupKeyword( &logToTable, logToStr );
 
+    // check for unknown name
+    if( returnVal == KEYWORD_NOT_FOUND )
+    {
         // set default return value to log to monitor
-        int returnVal = LOGTO_MONITOR_CODE;
+        returnVal = LOGTO_MONITOR_CODE;
+    }
 
-    // set temp string to lower case
-        // fucntion: setStrToLowerCase
-    setStrToLowerCase( tempStr, logToStr );
+    // return code found
+    return returnVal;
+}
 
-    // check for BOTH
-        // func: compareString
-    if( compareString( tempStr, "both") == STR_EQ )
-    {
-        // set return value to both code
-        returnVal = LOGTO_BOTH_CODE;
-    }
+/*
+Function name:  getClockModeCode
+Algorithm:      converts string data (e.g., "Real", "virtual") to constant
+                code number to be stored as integer
+Precondition:   clockModeStr is a C-Style string with one of the specified
+                clock modes
+Postcondition:  returns code representing clock mode
+Exceptions:     defaults to real (wall-clock) code
+Notes: none
+ */
+ConfigDataCodes getClockModeCode( char *clockModeStr )
+{
+    // intialize func/variables
 
-    // check for FILE
-        // func: compareString
-    if( compareString( tempStr, "file") == STR_EQ )
+        // look up clock mode name, case is ignored
+            // func: lookupKeyword
+        int returnVal = lookupKeyword( &clockModeTable, clockModeStr );
+
+    // check for unknown name
+    if( returnVal == KEYWORD_NOT_FOUND )
     {
-        // set return value to file code
-        returnVal = LOGTO_FILE_CODE;
+        // set default return value to real clock
+        returnVal = CLOCK_REAL_CODE;
     }
 
-    // free temp string memory
-        //func: free
-    free( tempStr );
-
     // return code found
     return returnVal;
 }
@@ -489,6 +658,13 @@ void displayConfigData( ConfigDataType *configData )
     configCodeToString( configData->logToCode, displayString );
     printf("Log to selection        : %s\n", displayString );
     printf("Log file name           : %s\n", configData->logToFileName );
+    configCodeToString( configData->clockCode, displayString );
+    printf("Clock mode              : %s\n", displayString );
+    printf("MLFQ levels             : %d\n", configData->mlfqLevels );
+    printf("MLFQ boost time (msec)  : %d\n", configData->mlfqBoostTime );
+    printf("Priority aging (msec)   : %d\n", configData->priorityAgingTime );
+    printf("Fair latency (msec)     : %d\n", configData->fairLatency );
+    printf("Fair granularity (msec) : %d\n", configData->fairGranularity );
 }
 
 /*
@@ -504,10 +680,13 @@ Notes: none
  */
 void configCodeToString( int code, char *outString )
 {
-    // Define array with eight items, and short (10) lengths
-    char displayStrings[ 8 ][ 10 ] = {  "SJF-N", "SRTF-P", "FCFS-P",
+    // Define array with seventeen items, and short (11) lengths
+    char displayStrings[ 17 ][ 11 ] = { "SJF-N", "SRTF-P", "FCFS-P",
                                         "RR-P", "FCFS-N", "Monitor",
-                                        "File", "Both" };
+                                        "File", "Both", "Real",
+                                        "Virtual", "MLFQ-P", "PRIORITY-N",
+                                        "PRIORITY-P", "FAIR-P", "STRIDE-P",
+                                        "LOTTERY-P", "EDF-P" };
     // copy string to return paramter
         //func: copyString
     copyString( outString, displayStrings[ code ] );
@@ -5,6 +5,14 @@
 #include "StringUtils.h"
 
 // global constants
+    // Note: levels are buckets of the ready set, which has at most 64
+#define MLFQ_MAX_LEVELS 8
+#define MLFQ_DEFAULT_LEVELS 3
+#define MLFQ_DEFAULT_BOOST_TIME 1000
+#define PRIORITY_DEFAULT_AGING_TIME 1000
+#define FAIR_DEFAULT_LATENCY 240
+#define FAIR_DEFAULT_GRANULARITY 30
+
     // Note: starts at 3 so it does not compete with StringManipCode values
 typedef enum {  CFG_FILE_ACCESS_ERR = 3,
                 CFG_CORRUPT_DESCRIPTOR_ERR,
@@ -18,7 +26,14 @@ typedef enum {  CFG_FILE_ACCESS_ERR = 3,
                 CFG_PROC_CYCLES_CODE,
                 CFG_IO_CYCLES_CODE,
                 CFG_LOG_TO_CODE,
-                CFG_LOG_FILE_NAME_CODE } ConfigCodeMessages;
+                CFG_LOG_FILE_NAME_CODE,
+                CFG_CLOCK_MODE_CODE,
+                CFG_MLFQ_LEVELS_CODE,
+                CFG_MLFQ_QUANTA_CODE,
+                CFG_MLFQ_BOOST_CODE,
+                CFG_PRIORITY_AGING_CODE,
+                CFG_FAIR_LATENCY_CODE,
+                CFG_FAIR_GRANULARITY_CODE } ConfigCodeMessages;
 
 
 typedef enum {  CPU_SCHED_SJF_N_CODE,
@@ -28,7 +43,16 @@ typedef enum {  CPU_SCHED_SJF_N_CODE,
                 CPU_SCHED_FCFS_N_CODE,
                 LOGTO_MONITOR_CODE,
                 LOGTO_FILE_CODE,
-                LOGTO_BOTH_CODE } ConfigDataCodes;
+                LOGTO_BOTH_CODE,
+                CLOCK_REAL_CODE,
+                CLOCK_VIRTUAL_CODE,
+                CPU_SCHED_MLFQ_P_CODE,
+                CPU_SCHED_PRIORITY_N_CODE,
+                CPU_SCHED_PRIORITY_P_CODE,
+                CPU_SCHED_FAIR_P_CODE,
+                CPU_SCHED_STRIDE_P_CODE,
+                CPU_SCHED_LOTTERY_P_CODE,
+                CPU_SCHED_EDF_P_CODE } ConfigDataCodes;
 
 // config data structure
 typedef struct
@@ -42,6 +66,14 @@ typedef struct
     int ioCycleRate;
     int logToCode;
     char logToFileName[ 100 ];
+    int clockCode;
+    int mlfqLevels;
+    int mlfqQuanta[ MLFQ_MAX_LEVELS ];
+    int mlfqQuantaCount;
+    int mlfqBoostTime;
+    int priorityAgingTime;
+    int fairLatency;
+    int fairGranularity;
 } ConfigDataType;
 
 // function prototypes
@@ -50,6 +82,9 @@ int getDataLineCode( char *dataBuffer );
 ConfigDataCodes getCpuSchedCode( char *codeStr );
 Boolean valueInRange( int lineCode, int intVal, double doubleVal, char *stringVal );
 ConfigDataCodes getLogToCode( char *logToStr );
+ConfigDataCodes getClockModeCode( char *clockModeStr );
+int getQuantumList( char *quantumStr, int *quanta );
+void setMlfqQuanta( ConfigDataType *configData );
 void displayConfigData( ConfigDataType *configData );
 void configCodeToString( int code, char *outString );
 void displayConfigError( int errCode );
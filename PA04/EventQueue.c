@@ -0,0 +1,164 @@
+// Header files
+#include <stdlib.h>
+
+#include "EventQueue.h"
+
+// Initial number of events the heap can hold before growing
+static const int INITIAL_EVENT_CAPACITY = 16;
+
+/**
+ * @details Orders two events by time. Events scheduled for the same time
+ *          keep the order in which they were pushed.
+ *
+ * @return Boolean Returns True if first should be popped before second
+ */
+static Boolean eventBefore(SimEvent *first, SimEvent *second)
+{
+    if (first->eventTime != second->eventTime)
+    {
+        return first->eventTime < second->eventTime;
+    }
+    return first->sequence < second->sequence;
+}
+
+static void swapEvents(EventQueue *queue, int oneIndex, int otherIndex)
+{
+    SimEvent temp = queue->events[oneIndex];
+    queue->events[oneIndex] = queue->events[otherIndex];
+    queue->events[otherIndex] = temp;
+}
+
+/**
+ * @brief Schedules a new event.
+ *
+ * @details Appends the event to the heap array, growing it as needed,
+ *          and sifts it up to its place. O(log n).
+ *
+ * @param[in] queue Event queue
+ *
+ * @param[in] eventTime Simulated time, in nanoseconds, the event fires at
+ *
+ * @param[in] processNum Process that scheduled the event
+ *
+ * @param[in] cycleTime Cycle time of the op code that caused the event
+ *
+ * @param[in] outputStr Log line to output when the event is resolved
+ */
+void pushEvent(EventQueue *queue, long long eventTime, int processNum,
+               int cycleTime, char *outputStr)
+{
+    int index;
+    int parent;
+
+    if (queue->size == queue->capacity)
+    {
+        queue->capacity = (queue->capacity == 0) ? INITIAL_EVENT_CAPACITY
+                                                 : queue->capacity * 2;
+        queue->events = (SimEvent *)realloc(queue->events,
+                                            queue->capacity * sizeof(SimEvent));
+    }
+
+    index = queue->size;
+    queue->size++;
+
+    queue->events[index].eventTime = eventTime;
+    queue->events[index].sequence = queue->nextSequence;
+    queue->events[index].processNum = processNum;
+    queue->events[index].cycleTime = cycleTime;
+    copyString(queue->events[index].outputStr, outputStr);
+    queue->nextSequence++;
+
+    while (index > 0)
+    {
+        parent = (index - 1) / 2;
+        if (!eventBefore(&queue->events[index], &queue->events[parent]))
+        {
+            break;
+        }
+        swapEvents(queue, index, parent);
+        index = parent;
+    }
+}
+
+/**
+ * @brief Removes the earliest event if it is due.
+ *
+ * @param[in] queue Event queue
+ *
+ * @param[in] currentTime Current simulated time in nanoseconds
+ *
+ * @param[out] event Copy of the removed event
+ *
+ * @return Boolean Returns True if an event at or before currentTime
+ *                 was removed
+ */
+Boolean popDueEvent(EventQueue *queue, long long currentTime, SimEvent *event)
+{
+    int index = 0;
+    int child;
+
+    if (queue->size == 0 || queue->events[0].eventTime > currentTime)
+    {
+        return False;
+    }
+
+    *event = queue->events[0];
+    queue->size--;
+    queue->events[0] = queue->events[queue->size];
+
+    while (True)
+    {
+        child = 2 * index + 1;
+        if (child >= queue->size)
+        {
+            break;
+        }
+        if ((child + 1 < queue->size) && eventBefore(&queue->events[child + 1], &queue->events[child]))
+        {
+            child++;
+        }
+        if (!eventBefore(&queue->events[child], &queue->events[index]))
+        {
+            break;
+        }
+        swapEvents(queue, index, child);
+        index = child;
+    }
+    return True;
+}
+
+/**
+ * @details Reports the time of the earliest pending event.
+ *
+ * @param[in] queue Event queue
+ *
+ * @param[out] eventTime Time of the earliest event in nanoseconds
+ *
+ * @return Boolean Returns False if the queue is empty
+ */
+Boolean nextEventTime(EventQueue *queue, long long *eventTime)
+{
+    if (queue->size == 0)
+    {
+        return False;
+    }
+    *eventTime = queue->events[0].eventTime;
+    return True;
+}
+
+/**
+ * @brief Clears event queue.
+ *
+ * @details Returns the heap array to the OS and resets the queue
+ *          to the empty state.
+ *
+ * @param[in] queue Event queue
+ */
+void clearEventQueue(EventQueue *queue)
+{
+    free(queue->events);
+    queue->events = NULL;
+    queue->size = 0;
+    queue->capacity = 0;
+    queue->nextSequence = 0;
+}
@@ -0,0 +1,34 @@
+// Pre-compiler directive
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "StringUtils.h"
+
+// Pending I/O completion, keyed by simulated time
+typedef struct
+{
+    long long eventTime;
+    long long sequence;
+    int processNum;
+    int cycleTime;
+    char outputStr[200];
+} SimEvent;
+
+// Binary min-heap of pending events
+// A zeroed EventQueue is a valid empty queue
+typedef struct
+{
+    SimEvent *events;
+    int size;
+    int capacity;
+    long long nextSequence;
+} EventQueue;
+
+// Function Prototypes
+void pushEvent(EventQueue *queue, long long eventTime, int processNum,
+               int cycleTime, char *outputStr);
+Boolean popDueEvent(EventQueue *queue, long long currentTime, SimEvent *event);
+Boolean nextEventTime(EventQueue *queue, long long *eventTime);
+void clearEventQueue(EventQueue *queue);
+
+#endif // EVENT_QUEUE_H
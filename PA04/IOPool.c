@@ -0,0 +1,153 @@
+// Header files
+#include <sys/time.h>
+
+#include "IOPool.h"
+
+static long long currentNanoSec(void)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_usec * 1000LL;
+}
+
+/**
+ * @brief I/O worker thread.
+ *
+ * @details Sleeps until the earliest pending request is due or a new
+ *          request arrives, then completes every due request.
+ *          Waits are absolute, so time spent queued counts toward
+ *          the I/O op.
+ *
+ * @param[in] poolPtr Pool the worker belongs to
+ */
+static void *ioWorker(void *poolPtr)
+{
+    IOPool *pool = (IOPool *)poolPtr;
+    SimEvent request;
+    long long completionTime;
+    struct timespec deadline;
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->shuttingDown)
+    {
+        if (!nextEventTime(&pool->requests, &completionTime))
+        {
+            pthread_cond_wait(&pool->requestReady, &pool->lock);
+        }
+        else if (popDueEvent(&pool->requests, currentNanoSec(), &request))
+        {
+            if (pool->completionHandler != NULL)
+            {
+                pool->completionHandler(&request);
+            }
+            if (pool->requests.size == 0)
+            {
+                pthread_cond_broadcast(&pool->requestsDone);
+            }
+        }
+        else
+        {
+            deadline.tv_sec = completionTime / 1000000000LL;
+            deadline.tv_nsec = completionTime % 1000000000LL;
+            pthread_cond_timedwait(&pool->requestReady, &pool->lock, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Starts the I/O worker threads.
+ *
+ * @param[out] pool Pool to initialize
+ *
+ * @param[in] completionHandler Called for each completed request,
+ *                              NULL if callers only wait for completion
+ */
+void startIOPool(IOPool *pool, IOCompletionHandler completionHandler)
+{
+    int index;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->requestReady, NULL);
+    pthread_cond_init(&pool->requestsDone, NULL);
+    pool->requests.events = NULL;
+    pool->requests.size = 0;
+    pool->requests.capacity = 0;
+    pool->requests.nextSequence = 0;
+    pool->completionHandler = completionHandler;
+    pool->shuttingDown = False;
+
+    for (index = 0; index < IO_WORKER_COUNT; index++)
+    {
+        pthread_create(&pool->workers[index], NULL, ioWorker, pool);
+    }
+}
+
+/**
+ * @brief Queues an I/O op.
+ *
+ * @details The request is copied into the pool, so the caller's
+ *          buffers may go out of scope as soon as this returns.
+ *
+ * @param[in] pool I/O pool
+ *
+ * @param[in] processNum Process that issued the op
+ *
+ * @param[in] cycleTime Length of the op in milliseconds
+ *
+ * @param[in] outputStr Log line to output when the op completes
+ */
+void submitIORequest(IOPool *pool, int processNum, int cycleTime, char *outputStr)
+{
+    pthread_mutex_lock(&pool->lock);
+    pushEvent(&pool->requests, currentNanoSec() + (long long)cycleTime * 1000000LL,
+              processNum, cycleTime, outputStr);
+    pthread_cond_signal(&pool->requestReady);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @details Blocks until every submitted request has completed.
+ *
+ * @param[in] pool I/O pool
+ */
+void waitForIOPool(IOPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    while (pool->requests.size > 0)
+    {
+        pthread_cond_wait(&pool->requestsDone, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Stops the I/O worker threads.
+ *
+ * @details Joins the workers and releases the queue, mutex, and
+ *          condition variables. Requests still pending are dropped.
+ *
+ * @param[in] pool I/O pool
+ */
+void stopIOPool(IOPool *pool)
+{
+    int index;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shuttingDown = True;
+    pthread_cond_broadcast(&pool->requestReady);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (index = 0; index < IO_WORKER_COUNT; index++)
+    {
+        pthread_join(pool->workers[index], NULL);
+    }
+
+    clearEventQueue(&pool->requests);
+    pthread_cond_destroy(&pool->requestsDone);
+    pthread_cond_destroy(&pool->requestReady);
+    pthread_mutex_destroy(&pool->lock);
+}
@@ -0,0 +1,35 @@
+// Pre-compiler directive
+#ifndef IO_POOL_H
+#define IO_POOL_H
+
+#include <pthread.h>
+
+#include "EventQueue.h"
+
+// Number of persistent I/O worker threads
+#define IO_WORKER_COUNT 4
+
+// Called by a worker, with the pool locked, when an I/O request completes
+typedef void (*IOCompletionHandler)(SimEvent *request);
+
+// Fixed pool of I/O workers fed through a submission queue
+// Requests are stored by value in the queue, ordered by completion time,
+// so any number of overlapping I/O ops finish on time
+typedef struct
+{
+    pthread_t workers[IO_WORKER_COUNT];
+    pthread_mutex_t lock;
+    pthread_cond_t requestReady;
+    pthread_cond_t requestsDone;
+    EventQueue requests;
+    IOCompletionHandler completionHandler;
+    Boolean shuttingDown;
+} IOPool;
+
+// Function Prototypes
+void startIOPool(IOPool *pool, IOCompletionHandler completionHandler);
+void submitIORequest(IOPool *pool, int processNum, int cycleTime, char *outputStr);
+void waitForIOPool(IOPool *pool);
+void stopIOPool(IOPool *pool);
+
+#endif // IO_POOL_H
@@ -0,0 +1,123 @@
+// Header files
+#include "InterruptQueue.h"
+
+/**
+ * @brief Posts an interrupt from any thread.
+ *
+ * @details Pushes a new node onto the queue head with a compare-and-swap
+ *          loop, O(1), then wakes the consumer if it is waiting.
+ *
+ * @param[in] queue Interrupt queue
+ *
+ * @param[in] processNum Process whose I/O completed
+ *
+ * @param[in] cycleTime Cycle time of the completed op code
+ *
+ * @param[in] outputStr Log line to output when the interrupt is resolved
+ */
+void postInterrupt(InterruptQueue *queue, int processNum, int cycleTime,
+                   char *outputStr)
+{
+    InterruptNode *node = (InterruptNode *)slabAlloc(&queue->nodes);
+
+    node->processNum = processNum;
+    node->cycleTime = cycleTime;
+    copyString(node->outputStr, outputStr);
+
+    node->next = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&queue->head, &node->next, node, True,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+        // node->next was refreshed with the current head, try again
+    }
+
+    // Signal under the lock so a consumer between its check and its wait
+    // cannot miss the wakeup
+    pthread_mutex_lock(&queue->waitLock);
+    pthread_cond_signal(&queue->arrived);
+    pthread_mutex_unlock(&queue->waitLock);
+}
+
+/**
+ * @brief Takes every pending interrupt.
+ *
+ * @details Swaps the queue head with NULL in one atomic exchange, then
+ *          reverses the taken nodes so they come out in posting order.
+ *          Only the consumer thread may call this.
+ *
+ * @param[in] queue Interrupt queue
+ *
+ * @return InterruptNode Oldest pending interrupt, NULL if none.
+ *                       The caller releases the nodes
+ */
+InterruptNode *drainInterrupts(InterruptQueue *queue)
+{
+    InterruptNode *node = __atomic_exchange_n(&queue->head, NULL, __ATOMIC_ACQUIRE);
+    InterruptNode *ordered = NULL;
+    InterruptNode *next;
+
+    while (node != NULL)
+    {
+        next = node->next;
+        node->next = ordered;
+        ordered = node;
+        node = next;
+    }
+    return ordered;
+}
+
+/**
+ * @details Returns a drained node to the queue's slab cache for reuse.
+ *
+ * @param[in] queue Interrupt queue the node was drained from
+ *
+ * @param[in] node Resolved interrupt
+ */
+void releaseInterrupt(InterruptQueue *queue, InterruptNode *node)
+{
+    slabFree(&queue->nodes, node);
+}
+
+/**
+ * @details Reports whether any interrupt has been posted and not drained.
+ *
+ * @param[in] queue Interrupt queue
+ *
+ * @return Boolean Returns True if the queue is not empty
+ */
+Boolean interruptsPending(InterruptQueue *queue)
+{
+    return (__atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) != NULL);
+}
+
+/**
+ * @brief Sleeps until an interrupt is pending.
+ *
+ * @details Returns immediately if the queue is already non-empty.
+ *          Only the consumer thread may call this.
+ *
+ * @param[in] queue Interrupt queue
+ */
+void waitForInterrupts(InterruptQueue *queue)
+{
+    pthread_mutex_lock(&queue->waitLock);
+    while (!interruptsPending(queue))
+    {
+        pthread_cond_wait(&queue->arrived, &queue->waitLock);
+    }
+    pthread_mutex_unlock(&queue->waitLock);
+}
+
+/**
+ * @brief Clears interrupt queue.
+ *
+ * @details Drops any interrupts still pending and the cached nodes.
+ *          Node memory belongs to the arena and is released with it.
+ *
+ * @param[in] queue Interrupt queue
+ */
+void clearInterruptQueue(InterruptQueue *queue)
+{
+    drainInterrupts(queue);
+    resetSlabCache(&queue->nodes);
+}
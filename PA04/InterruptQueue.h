@@ -0,0 +1,45 @@
+// Pre-compiler directive
+#ifndef INTERRUPT_QUEUE_H
+#define INTERRUPT_QUEUE_H
+
+#include <pthread.h>
+
+#include "Arena.h"
+#include "StringUtils.h"
+
+// Interrupt List
+typedef struct InterruptNode
+{
+    int processNum;
+    char outputStr[200];
+    int cycleTime;
+    struct InterruptNode *next;
+} InterruptNode;
+
+// Lock-free multi-producer/single-consumer completion queue
+// Producers push onto head with compare-and-swap, the consumer takes
+// the whole list at once. The lock only guards sleeping on arrived.
+// Nodes come from a slab cache, so resolved ones are reused
+typedef struct
+{
+    InterruptNode *head;
+    pthread_mutex_t waitLock;
+    pthread_cond_t arrived;
+    SlabCache nodes;
+} InterruptQueue;
+
+// Static initializer for an empty queue taking its nodes from arena
+#define INTERRUPT_QUEUE_INITIALIZER(arena) \
+    { NULL, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, \
+      SLAB_CACHE_INITIALIZER(arena, sizeof(InterruptNode)) }
+
+// Function Prototypes
+void postInterrupt(InterruptQueue *queue, int processNum, int cycleTime,
+                   char *outputStr);
+InterruptNode *drainInterrupts(InterruptQueue *queue);
+void releaseInterrupt(InterruptQueue *queue, InterruptNode *node);
+Boolean interruptsPending(InterruptQueue *queue);
+void waitForInterrupts(InterruptQueue *queue);
+void clearInterruptQueue(InterruptQueue *queue);
+
+#endif // INTERRUPT_QUEUE_H
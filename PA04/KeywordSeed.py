@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# Seed search for the keyword tables in ConfigAccess.c and MetaDataAccess.c
+#
+# usage: python3 KeywordSeed.py <source file> <table name> [-w]
+#   e.g. python3 KeywordSeed.py ConfigAccess.c cpuSched
+#
+# Reads the keywords and codes of the named table (cpuSched for
+# cpuSchedSlots and cpuSchedTable), searches for the smallest power of two
+# size and the first seed that give every keyword its own slot under the
+# hash in KeywordTable.c, and prints the regenerated table. -w writes it
+# back into the source file instead. To add a keyword, add its entry to
+# any empty slot of the table and run the script.
+
+import re
+import sys
+
+FNV_PRIME = 16777619
+MAX_SEED = 200000
+
+
+# Same hash as lookupKeyword: seeded FNV-1a, high bits folded down
+def keywordHash(keyword, seed, ignoreCase):
+    hashValue = seed & 0xffffffff
+    for char in keyword.encode():
+        if ignoreCase and ord('A') <= char <= ord('Z'):
+            char += ord('a') - ord('A')
+        hashValue = ((hashValue ^ char) * FNV_PRIME) & 0xffffffff
+    return hashValue ^ (hashValue >> 16)
+
+
+# Smallest size, then smallest seed, placing every keyword in its own slot
+def findSeed(keywords, ignoreCase):
+    size = 1
+    while size < len(keywords):
+        size *= 2
+    while True:
+        for seed in range(1, MAX_SEED):
+            slots = [keywordHash(keyword, seed, ignoreCase) % size
+                     for keyword in keywords]
+            if len(set(slots)) == len(keywords):
+                return size, seed, slots
+        size *= 2
+
+
+def tablePattern(name):
+    return re.compile(r'static const KeywordEntry %sSlots\[ \d+ \] =\n\{\n'
+                      r'(?P<entries>.*?)\n\};\n'
+                      r'static const KeywordTable %sTable = '
+                      r'\{ %sSlots, \d+, \d+, (?P<ignoreCase>True|False) \};'
+                      % (name, name, name), re.S)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: KeywordSeed.py <source file> <table name> [-w]')
+    fileName, name = sys.argv[1], sys.argv[2]
+    with open(fileName) as sourceFile:
+        source = sourceFile.read()
+
+    match = tablePattern(name).search(source)
+    if match is None:
+        sys.exit('%s: no keyword table named %s' % (fileName, name))
+    entries = re.findall(r'\{ "([^"]*)", (\w+) \}', match.group('entries'))
+    ignoreCase = match.group('ignoreCase') == 'True'
+
+    # lookupKeyword lowers only the tested string, not the stored keyword
+    for keyword, code in entries:
+        if ignoreCase and keyword != keyword.lower():
+            sys.exit('%s: %s ignores case, store "%s" in lower case'
+                     % (fileName, name, keyword))
+
+    size, seed, slots = findSeed([keyword for keyword, code in entries],
+                                 ignoreCase)
+    table = [None] * size
+    for entry, slot in zip(entries, slots):
+        table[slot] = entry
+
+    lines = ['static const KeywordEntry %sSlots[ %d ] =' % (name, size), '{']
+    for index, entry in enumerate(table):
+        text = '{ NULL, 0 }' if entry is None else '{ "%s", %s }' % entry
+        lines.append('    ' + text + (',' if index < size - 1 else ''))
+    lines.append('};')
+    lines.append('static const KeywordTable %sTable = { %sSlots, %d, %d, %s };'
+                 % (name, name, size, seed, match.group('ignoreCase')))
+    generated = '\n'.join(lines)
+
+    if '-w' in sys.argv[3:]:
+        with open(fileName, 'w') as sourceFile:
+            sourceFile.write(source[:match.start()] + generated
+                             + source[match.end():])
+    else:
+        print(generated)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,63 @@
+// Header files
+#include <stdint.h>
+
+#include "KeywordTable.h"
+
+// FNV-1a multiplier
+static const uint32_t FNV_PRIME = 16777619u;
+
+/**
+ * @details Returns the character as the table compares it.
+ *
+ * @param[in] table Keyword table
+ *
+ * @param[in] testChar Character from the tested string
+ *
+ * @return char Lower case character if the table ignores case
+ */
+static char tableChar(const KeywordTable *table, char testChar)
+{
+    return table->ignoreCase ? setCharToLowerCase(testChar) : testChar;
+}
+
+/**
+ * @brief Looks up a keyword.
+ *
+ * @details Hashes the string once with seeded FNV-1a, probes the single
+ *          slot the hash selects, and verifies the keyword stored there.
+ *          O(length), no allocation.
+ *
+ * @param[in] table Keyword table
+ *
+ * @param[in] testStr String to look up
+ *
+ * @return int Code of the matching keyword, KEYWORD_NOT_FOUND if none
+ */
+int lookupKeyword(const KeywordTable *table, char *testStr)
+{
+    uint32_t hash = table->seed;
+    const KeywordEntry *entry;
+    int index;
+
+    for (index = 0; testStr[index] != NULL_CHAR; index++)
+    {
+        hash = (hash ^ (unsigned char)tableChar(table, testStr[index])) * FNV_PRIME;
+    }
+    // Fold the high bits down, the slot only uses the low ones
+    hash ^= hash >> 16;
+
+    entry = &table->slots[hash & (table->size - 1)];
+    if (entry->keyword == NULL)
+    {
+        return KEYWORD_NOT_FOUND;
+    }
+
+    for (index = 0; testStr[index] != NULL_CHAR; index++)
+    {
+        if (tableChar(table, testStr[index]) != entry->keyword[index])
+        {
+            return KEYWORD_NOT_FOUND;
+        }
+    }
+    return (entry->keyword[index] == NULL_CHAR) ? entry->code : KEYWORD_NOT_FOUND;
+}
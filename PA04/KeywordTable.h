@@ -0,0 +1,32 @@
+// Pre-compiler directive
+#ifndef KEYWORD_TABLE_H
+#define KEYWORD_TABLE_H
+
+#include "StringUtils.h"
+
+// Returned when a string is not one of the table's keywords
+#define KEYWORD_NOT_FOUND -1
+
+// One table slot, keyword is NULL for an empty slot
+typedef struct
+{
+    const char *keyword;
+    int code;
+} KeywordEntry;
+
+// Perfect-hash table over a fixed keyword set
+// The seed is chosen offline by KeywordSeed.py so that every keyword lands
+// in its own slot, size is a power of two. Tables with ignoreCase set hold
+// lower case keywords and fold the tested string while hashing
+typedef struct
+{
+    const KeywordEntry *slots;
+    unsigned int size;
+    unsigned int seed;
+    Boolean ignoreCase;
+} KeywordTable;
+
+// Function Prototypes
+int lookupKeyword(const KeywordTable *table, char *testStr);
+
+#endif // KEYWORD_TABLE_H
@@ -0,0 +1,223 @@
+// Header files
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "LogWriter.h"
+
+/**
+ * @brief Log writer thread.
+ *
+ * @details Waits for a full page, writes it to the log file with as few
+ *          write calls as the OS allows, then hands the page back. A
+ *          write interrupted by a signal is retried; any other failure,
+ *          or a write that makes no progress, is recorded and no further
+ *          pages are written. Exits once closing is set and no page is
+ *          waiting.
+ *
+ * @param[in] outputPtr Log the writer belongs to
+ */
+static void *logWriter(void *outputPtr)
+{
+    LogOutput *ouptutPtr = (LogOutput *)outputPtr;
+    char *page;
+    size_t remaining;
+    ssize_t written;
+    int writeError;
+
+    pthread_mutex_lock(&ouptutPtr->lock);
+    while (True)
+    {
+        while (ouptutPtr->flushSize == 0 && !ouptutPtr->closing)
+        {
+            pthread_cond_wait(&ouptutPtr->pageFull, &ouptutPtr->lock);
+        }
+        if (ouptutPtr->flushSize == 0)
+        {
+            break;
+        }
+        page = ouptutPtr->pages[ouptutPtr->flushPage];
+        remaining = (ouptutPtr->writeError == 0) ? ouptutPtr->flushSize : 0;
+        writeError = 0;
+        pthread_mutex_unlock(&ouptutPtr->lock);
+
+        // Disk time is spent without the lock held
+        while (remaining > 0)
+        {
+            written = write(ouptutPtr->fileDesc, page, remaining);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (written <= 0)
+            {
+                writeError = (written < 0) ? errno : EIO;
+                break;
+            }
+            page += written;
+            remaining -= written;
+        }
+
+        pthread_mutex_lock(&ouptutPtr->lock);
+        if (writeError != 0)
+        {
+            ouptutPtr->writeError = writeError;
+        }
+        ouptutPtr->flushSize = 0;
+        pthread_cond_signal(&ouptutPtr->pageFree);
+    }
+    pthread_mutex_unlock(&ouptutPtr->lock);
+
+    return NULL;
+}
+
+/**
+ * @details Hands the active page to the writer thread and starts filling
+ *          the other one. Only waits if the writer is still busy with
+ *          the previous page.
+ *
+ * @param[in] ouptutPtr Log output
+ */
+static void handOffPage(LogOutput *ouptutPtr)
+{
+    pthread_mutex_lock(&ouptutPtr->lock);
+    while (ouptutPtr->flushSize > 0)
+    {
+        pthread_cond_wait(&ouptutPtr->pageFree, &ouptutPtr->lock);
+    }
+    ouptutPtr->flushPage = ouptutPtr->activePage;
+    ouptutPtr->flushSize = ouptutPtr->fillSize;
+    ouptutPtr->activePage = 1 - ouptutPtr->activePage;
+    ouptutPtr->fillSize = 0;
+    pthread_cond_signal(&ouptutPtr->pageFull);
+    pthread_mutex_unlock(&ouptutPtr->lock);
+}
+
+/**
+ * @brief Opens the log file and starts the writer thread.
+ *
+ * @details With no file name, or if the file cannot be created, the log
+ *          is left closed and appended strings are dropped.
+ *
+ * @param[out] ouptutPtr Log output to initialize
+ *
+ * @param[in] outputFileName Log file to create, NULL when only
+ *                           logging to the monitor
+ */
+void openLogOutput(LogOutput *ouptutPtr, char *outputFileName)
+{
+    ouptutPtr->pages[0] = NULL;
+    ouptutPtr->pages[1] = NULL;
+    ouptutPtr->activePage = 0;
+    ouptutPtr->fillSize = 0;
+    ouptutPtr->flushPage = 0;
+    ouptutPtr->flushSize = 0;
+    ouptutPtr->closing = False;
+    ouptutPtr->fileDesc = -1;
+    ouptutPtr->writeError = 0;
+
+    if (outputFileName != NULL)
+    {
+        ouptutPtr->fileDesc = open(outputFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (ouptutPtr->fileDesc < 0)
+    {
+        return;
+    }
+
+    ouptutPtr->pages[0] = (char *)malloc(LOG_PAGE_SIZE);
+    ouptutPtr->pages[1] = (char *)malloc(LOG_PAGE_SIZE);
+    pthread_mutex_init(&ouptutPtr->lock, NULL);
+    pthread_cond_init(&ouptutPtr->pageFull, NULL);
+    pthread_cond_init(&ouptutPtr->pageFree, NULL);
+    pthread_create(&ouptutPtr->writer, NULL, logWriter, ouptutPtr);
+}
+
+/**
+ * @brief Appends a string to the log file.
+ *
+ * @details Copies the string into the active page, handing the page to
+ *          the writer thread each time it fills. O(length).
+ *
+ * @param[in] ouptutPtr Log output
+ *
+ * @param[in] logString Ouptut string to append
+ */
+void appendLogString(LogOutput *ouptutPtr, char *logString)
+{
+    size_t length;
+    size_t space;
+
+    if (ouptutPtr->fileDesc < 0)
+    {
+        return;
+    }
+
+    length = getStringLength(logString);
+    while (length > 0)
+    {
+        space = LOG_PAGE_SIZE - ouptutPtr->fillSize;
+        if (space > length)
+        {
+            space = length;
+        }
+        memcpy(ouptutPtr->pages[ouptutPtr->activePage] + ouptutPtr->fillSize,
+               logString, space);
+        ouptutPtr->fillSize += space;
+        logString += space;
+        length -= space;
+
+        if (ouptutPtr->fillSize == LOG_PAGE_SIZE)
+        {
+            handOffPage(ouptutPtr);
+        }
+    }
+}
+
+/**
+ * @brief Closes the log file.
+ *
+ * @details Flushes the partly filled page, stops the writer thread, and
+ *          releases the pages, file, mutex, and condition variables. If a
+ *          write or the close failed, the log file is incomplete and an
+ *          error is displayed.
+ *
+ * @param[in] ouptutPtr Log output
+ */
+void closeLogOutput(LogOutput *ouptutPtr)
+{
+    if (ouptutPtr->fileDesc < 0)
+    {
+        return;
+    }
+
+    if (ouptutPtr->fillSize > 0)
+    {
+        handOffPage(ouptutPtr);
+    }
+
+    pthread_mutex_lock(&ouptutPtr->lock);
+    ouptutPtr->closing = True;
+    pthread_cond_signal(&ouptutPtr->pageFull);
+    pthread_mutex_unlock(&ouptutPtr->lock);
+    pthread_join(ouptutPtr->writer, NULL);
+
+    if (close(ouptutPtr->fileDesc) != 0 && ouptutPtr->writeError == 0)
+    {
+        ouptutPtr->writeError = errno;
+    }
+    ouptutPtr->fileDesc = -1;
+    if (ouptutPtr->writeError != 0)
+    {
+        printf("\nERROR: Log file write failed, %s; log file is incomplete\n",
+               strerror(ouptutPtr->writeError));
+    }
+    free(ouptutPtr->pages[0]);
+    free(ouptutPtr->pages[1]);
+    pthread_cond_destroy(&ouptutPtr->pageFree);
+    pthread_cond_destroy(&ouptutPtr->pageFull);
+    pthread_mutex_destroy(&ouptutPtr->lock);
+}
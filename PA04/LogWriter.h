@@ -0,0 +1,39 @@
+// Pre-compiler directive
+#ifndef LOG_WRITER_H
+#define LOG_WRITER_H
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "StringUtils.h"
+
+// Size of each log page in bytes
+#define LOG_PAGE_SIZE 65536
+
+// Streaming log file writer
+// The simulator fills the active page while a background thread writes
+// the other one to the log file, so memory stays at two pages
+// writeError holds the errno of the first failed write, 0 if none; the
+// writer drops every page after it and closing reports it
+typedef struct LogOutput
+{
+    char *pages[2];
+    int activePage;
+    size_t fillSize;
+    int flushPage;
+    size_t flushSize;
+    int fileDesc;
+    int writeError;
+    Boolean closing;
+    pthread_t writer;
+    pthread_mutex_t lock;
+    pthread_cond_t pageFull;
+    pthread_cond_t pageFree;
+} LogOutput;
+
+// Function Prototypes
+void openLogOutput(LogOutput *ouptutPtr, char *outputFileName);
+void appendLogString(LogOutput *ouptutPtr, char *logString);
+void closeLogOutput(LogOutput *ouptutPtr);
+
+#endif // LOG_WRITER_H
@@ -0,0 +1,47 @@
+// header files
+#include <stdio.h>
+#include "MetaDataAccess.h"
+#include "MetaDataImage.h"
+
+/*
+Function name: main
+Algorithm: parses a text metadata file and writes it out as a
+           precompiled image the simulator maps without parsing
+Precondition: metadata file name and image file name given as
+              command line arguments
+Postcondition: returns 0 if the image was written, 1 otherwise
+Exceptions: metadata errors are displayed and no image is written
+Note: images hold op codes in this build's native layout, so they
+      should be compiled by the same build that runs them
+*/
+int main(int argc, char **argv)
+{
+    int mdAccessResult;
+    OpCodeType *mdDataPtr;
+
+    if (argc < 3)
+    {
+        printf("Usage: mdfc <metadata file> <image file>\n");
+        return 1;
+    }
+
+    mdAccessResult = getOpCodes(argv[1], &mdDataPtr);
+
+    if (mdAccessResult != NO_ERR)
+    {
+        displayMetaDataError(mdAccessResult);
+        mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+        printf("\n");
+        return 1;
+    }
+
+    if (!writeMetaDataImage(argv[2], mdDataPtr))
+    {
+        printf("ERROR: Unable to write image file %s\n", argv[2]);
+        mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+        return 1;
+    }
+
+    mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+    return 0;
+}
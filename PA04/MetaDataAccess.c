@@ -1,137 +1,185 @@
 // header files
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "MetaDataAccess.h"
+#include "KeywordTable.h"
+
+// number of bytes read from the metadata file at a time
+static const int READ_BLOCK_SIZE = 1048576;
+
+// smallest op stream share worth a parse thread
+static const long MIN_PARSE_CHUNK_SIZE = 4194304;
+
+// number of op codes the op code vector starts with
+static const int INITIAL_OP_CAPACITY = 1024;
+
+// op names in OpNameCodes order
+static char opNameStrings[ OP_INVALID_CODE ][ 11 ] = { "access", "allocate",
+                                            "end", "hard drive", "keyboard",
+                                            "printer", "monitor", "run",
+                                            "start" };
+
+// op name keyword table, generated by KeywordSeed.py
+    // Note: the seed places every op name in its own slot, so adding an
+    //       op name means searching for a new seed: add its entry to an
+    //       empty slot and run python3 KeywordSeed.py MetaDataAccess.c
+    //       opName -w
+static const KeywordEntry opNameSlots[ 16 ] =
+{
+    { NULL, 0 },
+    { "hard drive", OP_HARD_DRIVE_CODE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "run", OP_RUN_CODE },
+    { "start", OP_START_CODE },
+    { NULL, 0 },
+    { "monitor", OP_MONITOR_CODE },
+    { NULL, 0 },
+    { "end", OP_END_CODE },
+    { "allocate", OP_ALLOCATE_CODE },
+    { NULL, 0 },
+    { "access", OP_ACCESS_CODE },
+    { "printer", OP_PRINTER_CODE },
+    { "keyboard", OP_KEYBOARD_CODE },
+    { NULL, 0 }
+};
+static const KeywordTable opNameTable = { opNameSlots, 16, 16, False };
 
 /*
 Function Name:  getOpCodes
-Algorithm:      opens file, acquires op code data, returns pointer
-                to head of linked list
+Algorithm:      opens file through a buffered reader, checks the leader,
+                splits the op stream into one chunk per available core,
+                parses the chunks concurrently, then reduces the chunk
+                results in file order and joins the op codes into one block
 Precondition:   for correct operation, file is avilable, is formatted correctly,
                 and has all correctly formed op codes
-Postcondition:  in correct operation, returns pointer to head of
-                op code linked list
+Postcondition:  in correct operation, returns pointer to the first op code
+                of the op code block
 Exceptions:     correctly and appropriately (without program failure)
                 responds to and reports file access failure,
                 incorrectly formatted lead or end descriptors,
                 incorrectly formatted prompt, incorrect op code letter,
                 incorrect op code name, op code value out of range,
                 and incomplete file conditions
-Notes: none
+Notes: the first chunk that does not run out cleanly ends the op stream,
+       so errors are reported as a front to back parse would find them
  */
 int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
 {
     // initialize function/variables
 
-        // intialize read only constant
-        const char READ_ONLY_FLAG[] = "r";
-
         // initialize start and end counts for balanced app operations
-        int startCount = 0, endCount = 0;
-
-        // intialize local head pointer to null
-        OpCodeType *localHeadPtr = NULL;
+        int startCount = 0, endCount = 0, opCount = 0;
 
         // intialize variables
-        int accessResult;
-        char dataBuffer[ MAX_STR_LEN ];
-        OpCodeType *newNodePtr;
-        FILE *fileAccessPtr;
+        int accessResult, chunkCount, chunkIndex, lastChunk;
+        long bodyStart, bodySize = 0;
+        char *dataToken;
+        struct stat fileInfo;
+        OpCodeChunk *chunks;
+        MetaDataReader reader;
 
     // intialize op code data pointer in case of return error
     *opCodeDataHead = NULL;
 
     // open file for reading
-        // function: fopen
-    fileAccessPtr = fopen( fileName, READ_ONLY_FLAG );
-
-    // check for file open failure
-    if( fileAccessPtr == NULL )
+        // function: openMetaDataReader
+    if( openMetaDataReader( fileName, &reader ) == False )
     {
         // return file access error
         return MD_FILE_ACCESS_ERR;
     }
 
     // check first line for correct leader
-        // function: getLineTo, compareString
-    if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
-                        dataBuffer, IGNORE_LEADING_WS ) != NO_ERR
-    || compareString( dataBuffer, "Start Program Meta-Data Code" ) != STR_EQ )
+        // function: getReaderToken, compareString
+    if( getReaderToken( &reader, MAX_STR_LEN, COLON, &dataToken ) != NO_ERR
+    || compareString( dataToken, "Start Program Meta-Data Code" ) != STR_EQ )
     {
         // close file
-            // func: fclose
-        fclose( fileAccessPtr );
+            // func: closeMetaDataReader
+        closeMetaDataReader( &reader );
 
         // return corrupt descriptor error
         return MD_CORRUPT_DESCRIPTOR_ERR;
     }
 
-    // allocate memory for the temporary data structure
-        // function: malloc
-    newNodePtr = ( OpCodeType * ) malloc( sizeof( OpCodeType ) );
-
-    // get the first op command
-        // functoin: getOpCommand
-    accessResult = getOpCommand( fileAccessPtr, newNodePtr );
-
-    // get start and end counts for later comparison
-        // func: updateStartCount, updateEndCount
-    startCount = updateStartCount( startCount, newNodePtr->opName );
-    endCount = updateEndCount( endCount, newNodePtr->opName );
-
-    // check for failure of first complete op command
-    if( accessResult != COMPLETE_OPCMD_FOUND_MSG )
+    // find the op stream size, one chunk if the file size is unknown
+    // or the op stream comes from standard input
+        // func: getReaderOffset, stat, getParseChunkCount
+    bodyStart = getReaderOffset( &reader );
+    chunkCount = 1;
+    if( reader.filePtr != stdin && stat( fileName, &fileInfo ) == 0 )
     {
-        // close file
-            // func: fclose
-        fclose( fileAccessPtr );
-
-        // clear data from the structure list
-            // func: clearMetaDataList
-        *opCodeDataHead = clearMetaDataList( localHeadPtr );
-
-        // free temp structure memory
-            // func: free
-        free( newNodePtr );
+        bodySize = (long) fileInfo.st_size - bodyStart;
+        chunkCount = getParseChunkCount( bodySize );
+    }
 
-        // return result of operation
-        return accessResult;
+    // set up chunks, the first one continues with the leader's reader
+        // func: malloc
+    chunks = ( OpCodeChunk * ) malloc( chunkCount * sizeof( OpCodeChunk ) );
+    for( chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++ )
+    {
+        chunks[ chunkIndex ].fileName = fileName;
+        chunks[ chunkIndex ].startOffset = bodyStart
+                                    + bodySize / chunkCount * chunkIndex;
+        chunks[ chunkIndex ].endOffset = bodyStart
+                                    + bodySize / chunkCount * ( chunkIndex + 1 );
+        chunks[ chunkIndex ].reader.filePtr = NULL;
+        chunks[ chunkIndex ].list.ops = NULL;
+        chunks[ chunkIndex ].list.count = 0;
+        chunks[ chunkIndex ].list.capacity = 0;
+        chunks[ chunkIndex ].startCount = 0;
+        chunks[ chunkIndex ].endCount = 0;
     }
-    // loop across all remaining op commands
-    //  (while complete op commands are found)
+    chunks[ 0 ].reader = reader;
+    chunks[ chunkCount - 1 ].endOffset = LONG_MAX;
 
-    while( accessResult == COMPLETE_OPCMD_FOUND_MSG )
+    // parse the other chunks on their own threads while this one
+    // parses the first
+        // func: pthread_create, parseOpChunk, pthread_join
+    for( chunkIndex = 1; chunkIndex < chunkCount; chunkIndex++ )
     {
-        // add the new op command to the linked list
-            // func: addNode
-        localHeadPtr = addNode( localHeadPtr, newNodePtr );
+        pthread_create( &chunks[ chunkIndex ].thread, NULL,
+                                    parseChunkThread, &chunks[ chunkIndex ] );
+    }
+    parseOpChunk( &chunks[ 0 ] );
+    for( chunkIndex = 1; chunkIndex < chunkCount; chunkIndex++ )
+    {
+        pthread_join( chunks[ chunkIndex ].thread, NULL );
+    }
 
-        // get a new op command
-            // func: getOpCommand
-        accessResult = getOpCommand( fileAccessPtr, newNodePtr );
+    // reduce start/end counts in file order up to the chunk that
+    // ended the op stream
+    for( lastChunk = 0; lastChunk < chunkCount; lastChunk++ )
+    {
+        startCount += chunks[ lastChunk ].startCount;
+        endCount += chunks[ lastChunk ].endCount;
+        opCount += chunks[ lastChunk ].list.count;
 
-        // update start and end counts for later comparison
-            // func: updateStartCount, updateEndCount
-        startCount = updateStartCount( startCount, newNodePtr->opName );
-        endCount = updateEndCount( endCount, newNodePtr->opName );
+        if( chunks[ lastChunk ].result != COMPLETE_OPCMD_FOUND_MSG )
+        {
+            break;
+        }
     }
+    accessResult = chunks[ lastChunk ].result;
 
-    // after loop completion, check for last op command found
-    if( accessResult == LAST_OPCMD_FOUND_MSG )
+    // check for last op command found after the first op command
+    if( accessResult == LAST_OPCMD_FOUND_MSG && opCount > 1 )
     {
         // check for start and end op code counts equal
         if( startCount == endCount )
         {
-            // add the last node to the linked list
-                // func: addNode
-            localHeadPtr = addNode( localHeadPtr, newNodePtr );
-
             // set access result to no error for later operation
             accessResult = NO_ERR;
 
             // check last line for incorrect end descriptor
-                // func: getLineTo, compareString
-            if( getLineTo( fileAccessPtr, MAX_STR_LEN, PERIOD,
-                            dataBuffer, IGNORE_LEADING_WS ) != NO_ERR
-                || compareString( dataBuffer, "End Program Meta-Data Code" )
+                // func: getReaderToken, compareString
+            if( getReaderToken( &chunks[ lastChunk ].reader, MAX_STR_LEN,
+                                            PERIOD, &dataToken ) != NO_ERR
+                || compareString( dataToken, "End Program Meta-Data Code" )
                                                                     != STR_EQ )
             {
                 // set access result to corrupted descriptor error
@@ -147,34 +195,238 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
         }
     }
 
-    // check for any errors found (not no error)
-    if (accessResult != NO_ERR )
+    // check for no errors found
+    if( accessResult == NO_ERR )
     {
-        // clear the op command list
-            // func: clearMetaDataList
-        localHeadPtr = clearMetaDataList( localHeadPtr );
+        // join the chunk op codes behind the first chunk's
+            // func: mergeOpChunks
+        mergeOpChunks( chunks, lastChunk, opCount );
     }
 
-    // close access file
-        // func: fclose
-    fclose( fileAccessPtr );
+    // otherwise, clear the op command list
+    else
+    {
+        // func: free
+        free( chunks[ 0 ].list.ops );
+        chunks[ 0 ].list.ops = NULL;
+        chunks[ 0 ].list.count = 0;
+    }
 
-    // release temporary structure memory
-        // fucntion: freee
-    free( newNodePtr );
+    // close chunk files, release the other chunks' op codes
+        // func: closeMetaDataReader, free
+    for( chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++ )
+    {
+        if( chunks[ chunkIndex ].reader.filePtr != NULL )
+        {
+            closeMetaDataReader( &chunks[ chunkIndex ].reader );
+        }
+        if( chunkIndex > 0 )
+        {
+            free( chunks[ chunkIndex ].list.ops );
+        }
+    }
 
-    // assign temporary local head pointer to parameter return pointer
-    *opCodeDataHead = localHeadPtr;
+    // trim the op code vector, assign its head to parameter return pointer
+        // func: finishOpCodeList, free
+    *opCodeDataHead = finishOpCodeList( &chunks[ 0 ].list );
+    free( chunks );
 
     // return access result
     return accessResult;
 }
 
+/*
+Function Name:  getParseChunkCount
+Algorithm:      gives each available core a chunk of the op stream,
+                keeping every chunk at least the minimum chunk size
+Precondition:   op stream size in bytes
+Postcondition:  returns number of chunks, at least one
+Exceptions:     assumes one core if the core count is unavailable
+Notes: none
+ */
+int getParseChunkCount( long bodySize )
+{
+    // initialize function/variables
+        // func: sysconf
+    long coreCount = sysconf( _SC_NPROCESSORS_ONLN );
+    long chunkCount = bodySize / MIN_PARSE_CHUNK_SIZE;
+
+    // limit chunks to cores
+    if( chunkCount > coreCount )
+    {
+        chunkCount = coreCount;
+    }
+
+    // always parse at least one chunk
+    if( chunkCount < 1 )
+    {
+        chunkCount = 1;
+    }
+
+    // return chunk count
+    return (int) chunkCount;
+}
+
+/*
+Function Name:  parseOpChunk
+Algorithm:      parses op commands into the chunk's op code vector until
+                S(end), an error, or an op command that starts at or past
+                the chunk end, counting start and end op commands
+Precondition:   chunk reader is open and positioned at the beginning of
+                the chunk's first op command
+Postcondition:  chunk holds its op commands and start/end counts; result is
+                COMPLETE_OPCMD_FOUND_MSG if the chunk ran out cleanly,
+                LAST_OPCMD_FOUND_MSG at S(end), otherwise the error found
+Exceptions:     errors are recorded in the chunk result
+Notes: S(end) is kept as the chunk's last op command
+ */
+void parseOpChunk( OpCodeChunk *chunk )
+{
+    // initialize function/variables
+    int accessResult = COMPLETE_OPCMD_FOUND_MSG;
+    OpCodeType newOp;
+
+    // loop across op commands that start inside the chunk
+        // func: getReaderOffset
+    while( getReaderOffset( &chunk->reader ) < chunk->endOffset )
+    {
+        // get a new op command, stop at any error
+            // func: getOpCommand
+        accessResult = getOpCommand( &chunk->reader, &newOp );
+        if( accessResult != COMPLETE_OPCMD_FOUND_MSG
+                            && accessResult != LAST_OPCMD_FOUND_MSG )
+        {
+            break;
+        }
+
+        // update start and end counts for the reduction
+            // func: updateStartCount, updateEndCount
+        chunk->startCount = updateStartCount( chunk->startCount,
+                                                            newOp.opName );
+        chunk->endCount = updateEndCount( chunk->endCount, newOp.opName );
+
+        // add the new op command to the op code vector
+            // func: addNode
+        addNode( &chunk->list, &newOp );
+
+        // check for last op command
+        if( accessResult == LAST_OPCMD_FOUND_MSG )
+        {
+            break;
+        }
+    }
+
+    // set chunk result
+    chunk->result = accessResult;
+}
+
+/*
+Function Name:  parseChunkThread
+Algorithm:      opens the chunk's own reader one byte before the chunk start,
+                skips the op command the previous chunk owns, then parses
+                the chunk
+Precondition:   chunk has file name and offsets set
+Postcondition:  chunk is parsed as by parseOpChunk
+Exceptions:     records file access error if the file cannot be opened
+Notes: thread entry point
+ */
+void *parseChunkThread( void *chunkPtr )
+{
+    // initialize function/variables
+    OpCodeChunk *chunk = ( OpCodeChunk * ) chunkPtr;
+
+    // open own reader
+        // func: openMetaDataReader
+    if( openMetaDataReader( chunk->fileName, &chunk->reader ) == False )
+    {
+        // record file access error
+        chunk->result = MD_FILE_ACCESS_ERR;
+        return NULL;
+    }
+
+    // move past the first semicolon at or after the byte before the
+    // chunk start, the next op command begins inside the chunk
+        // func: seekMetaDataReader, skipReaderPast
+    seekMetaDataReader( &chunk->reader, chunk->startOffset - 1 );
+    if( skipReaderPast( &chunk->reader, SEMICOLON ) == False )
+    {
+        // no op command begins in this chunk
+        chunk->result = COMPLETE_OPCMD_FOUND_MSG;
+        return NULL;
+    }
+
+    // parse the chunk
+        // func: parseOpChunk
+    parseOpChunk( chunk );
+
+    return NULL;
+}
+
+/*
+Function Name:  mergeOpChunks
+Algorithm:      grows the first chunk's vector to hold every op code, then
+                copies the following chunks behind it concurrently
+Precondition:   chunks up to the last chunk parsed without error and hold
+                the given number of op codes between them
+Postcondition:  first chunk's vector holds every op code in file order
+Exceptions:     none
+Notes: the other chunks' vectors are left for the caller to free
+ */
+void mergeOpChunks( OpCodeChunk *chunks, int lastChunk, int opCount )
+{
+    // initialize function/variables
+    OpCodeList *list = &chunks[ 0 ].list;
+    int destIndex = list->count;
+    int chunkIndex;
+
+    // grow the first vector to the final size
+        // func: realloc
+    list->ops = ( OpCodeType * ) realloc( list->ops,
+                                            opCount * sizeof( OpCodeType ) );
+    list->capacity = opCount;
+
+    // copy each chunk to its place
+        // func: pthread_create, pthread_join
+    for( chunkIndex = 1; chunkIndex <= lastChunk; chunkIndex++ )
+    {
+        chunks[ chunkIndex ].destination = list->ops + destIndex;
+        destIndex += chunks[ chunkIndex ].list.count;
+        pthread_create( &chunks[ chunkIndex ].thread, NULL,
+                                    copyChunkThread, &chunks[ chunkIndex ] );
+    }
+    for( chunkIndex = 1; chunkIndex <= lastChunk; chunkIndex++ )
+    {
+        pthread_join( chunks[ chunkIndex ].thread, NULL );
+    }
+    list->count = opCount;
+}
+
+/*
+Function Name:  copyChunkThread
+Algorithm:      copies the chunk's op codes to its destination
+Precondition:   chunk destination has room for the chunk's op codes
+Postcondition:  op codes are copied
+Exceptions:     none
+Notes: thread entry point
+ */
+void *copyChunkThread( void *chunkPtr )
+{
+    // initialize function/variables
+    OpCodeChunk *chunk = ( OpCodeChunk * ) chunkPtr;
+
+    // copy op codes
+        // func: memcpy
+    memcpy( chunk->destination, chunk->list.ops,
+                                chunk->list.count * sizeof( OpCodeType ) );
+
+    return NULL;
+}
+
 /*
 Function Name:  getOpCommand
 Algorithm:      acquires one op command, verifies all parts of it,
                 returns as parameter
-Precondition:   file is open and file cursor is at beginning of an op code
+Precondition:   reader is open and its position is at beginning of an op code
 Postcondition:  in correct operation, finds, tests, and returns op command as
                 parameter, and returns status as integer
                 - either complete op command found,
@@ -183,9 +435,9 @@ Exceptions:     correctly and appropriately (without program failure) responds
                 to and reports files access failure, incorrectly formatted op
                 command letter, incorrectly formatted op command name, and/or
                 incorrect or out of range of command value
-Notes: none
+Notes: the op command is parsed in place in the reader buffer
  */
-int getOpCommand( FILE *filePtr, OpCodeType *inData )
+int getOpCommand( MetaDataReader *reader, OpCodeType *inData )
 {
     // initialize func/vars
 
@@ -202,12 +454,13 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
 
         // intialize otehr variables
         int accessResult;
-        char strBuffer[ STD_STR_LEN ];
+        char *strBuffer;
+        char nameBuffer[ 11 ];
 
     //get whole op commadn as a string
-        // func: getLineTo
-    accessResult = getLineTo( filePtr, STD_STR_LEN, SEMICOLON,
-                                        strBuffer, IGNORE_LEADING_WS );
+        // func: getReaderToken
+    accessResult = getReaderToken( reader, STD_STR_LEN, SEMICOLON,
+                                                                &strBuffer );
 
     // check for successful access
     if( accessResult == NO_ERR )
@@ -247,34 +500,43 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
     }
 
     // loop until left paren found
-    while( sourceIndex < STD_STR_LEN && strBuffer[ sourceIndex ] != LEFT_PAREN )
+    // the token ends at its null character, never read past it
+    while( strBuffer[ sourceIndex ] != NULL_CHAR
+                && strBuffer[ sourceIndex ] != LEFT_PAREN )
     {
         // increment source index
         sourceIndex++;
     }
 
     // skip left paren element, increment source index
-    sourceIndex++;
+    if( strBuffer[ sourceIndex ] == LEFT_PAREN )
+    {
+        sourceIndex++;
+    }
 
     // set op command text
     // loop until right parent found
-    while( sourceIndex < STD_STR_LEN
+    nameBuffer[ destIndex ] = NULL_CHAR;
+    while( strBuffer[ sourceIndex ] != NULL_CHAR
             && destIndex < MAX_OP_NAME_LENGTH
                 && strBuffer[ sourceIndex ] != RIGHT_PAREN )
     {
         // acquire letter
-        inData->opName[ destIndex ] = strBuffer[ sourceIndex ];
+        nameBuffer[ destIndex ] = strBuffer[ sourceIndex ];
 
         // increment source and destination indices
         destIndex++; sourceIndex++;
 
         // set end/null character to current end of string
-        inData->opName[ destIndex ] = NULL_CHAR;
+        nameBuffer[ destIndex ] = NULL_CHAR;
     }
 
+    // intern op string as its code
+        // func: getOpNameCode
+    inData->opName = getOpNameCode( nameBuffer );
+
     // check for incorrect op string
-        // func: checkOpString
-    if( checkOpString( inData->opName ) == False )
+    if( inData->opName == OP_INVALID_CODE )
     {
         // set struct to null
         inData = NULL;
@@ -284,14 +546,16 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
     }
 
     // skip right paren element - increment source index, reset dest index
-    sourceIndex++;
+    if( strBuffer[ sourceIndex ] == RIGHT_PAREN )
+    {
+        sourceIndex++;
+    }
     destIndex = 0;
 
     // get integer value
     // loop while digits are found
         // function: isDigit
-    while( sourceIndex < STD_STR_LEN
-            && destIndex < MAX_OP_VALUE_LENGTH
+    while( destIndex < MAX_OP_VALUE_LENGTH
                 && isDigit( strBuffer [ sourceIndex ] ) == True )
     {
         // multiply current buffer by ten
@@ -304,7 +568,7 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
          destIndex++; sourceIndex++;
     }
     // check for loop overrun failure, check specified lengths
-    if( sourceIndex == STD_STR_LEN || destIndex == MAX_OP_VALUE_LENGTH )
+    if( destIndex == MAX_OP_VALUE_LENGTH )
     {
        // set struct to null
         inData = NULL;
@@ -316,9 +580,7 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
     inData->opValue = intBuffer;
 
     // check for last op command "S(end)0"
-        // func: compareString
-    if( inData->opLtr == 'S'
-            && compareString( inData->opName, "end" ) == STR_EQ )
+    if( inData->opLtr == 'S' && inData->opName == OP_END_CODE )
     {
         // return last op command found message
         return LAST_OPCMD_FOUND_MSG;
@@ -327,20 +589,318 @@ int getOpCommand( FILE *filePtr, OpCodeType *inData )
     return COMPLETE_OPCMD_FOUND_MSG;
 }
 
+/*
+Function Name:  openMetaDataReader
+Algorithm:      opens file, allocates the first block buffer
+Precondition:   none
+Postcondition:  in correct operation, reader is ready to return tokens
+                from the beginning of the file
+Exceptions:     returns false if the file cannot be opened
+Notes: file name "-" reads the metadata from standard input
+ */
+Boolean openMetaDataReader( char *fileName, MetaDataReader *reader )
+{
+    // open file for reading, or take standard input
+        // func: compareString, fopen
+    if( compareString( fileName, STDIN_FILE_NAME ) == STR_EQ )
+    {
+        reader->filePtr = stdin;
+    }
+    else
+    {
+        reader->filePtr = fopen( fileName, "r" );
+    }
+
+    // check for file open failure
+    if( reader->filePtr == NULL )
+    {
+        // return failure
+        return False;
+    }
+
+    // allocate empty block buffer
+        // func: malloc
+    reader->buffer = ( char * ) malloc( READ_BLOCK_SIZE );
+    reader->capacity = READ_BLOCK_SIZE;
+    reader->fileOffset = 0;
+    reader->size = 0;
+    reader->position = 0;
+
+    // return success
+    return True;
+}
+
+/*
+Function Name:  fillReaderBuffer
+Algorithm:      moves unread bytes to the front of the buffer,
+                then reads the next block of the file behind them
+Precondition:   reader is open
+Postcondition:  reader position is zero, buffer holds the unread bytes
+                followed by as much of the file as fits
+Exceptions:     returns false if no more bytes could be read
+Notes: buffer doubles if one token spans the whole buffer; reads take
+       whatever the file has ready, so op commands piped in are returned
+       as they arrive rather than once a whole block has been written
+ */
+Boolean fillReaderBuffer( MetaDataReader *reader )
+{
+    // initialize function/variables
+    int unreadSize = reader->size - reader->position;
+    int bytesRead;
+
+    // move unread bytes to the front, the buffer now starts at the
+    // first unread byte of the file
+        // func: memmove
+    reader->fileOffset += reader->position;
+    memmove( reader->buffer, reader->buffer + reader->position, unreadSize );
+    reader->size = unreadSize;
+    reader->position = 0;
+
+    // check for no room left behind the unread bytes
+    if( reader->size == reader->capacity )
+    {
+        // grow the buffer
+            // func: realloc
+        reader->capacity *= 2;
+        reader->buffer = ( char * ) realloc( reader->buffer,
+                                                        reader->capacity );
+    }
+
+    // read the next block
+        // func: read, fileno
+    bytesRead = read( fileno( reader->filePtr ), reader->buffer + reader->size,
+                                            reader->capacity - reader->size );
+    if( bytesRead < 0 )
+    {
+        bytesRead = 0;
+    }
+    reader->size += bytesRead;
+
+    // return whether anything new was read
+    return ( bytesRead > 0 );
+}
+
+/*
+Function Name:  getReaderToken
+Algorithm:      skips leading white space, finds the stop character,
+                replaces it with a null character, and returns the token
+                in place in the reader buffer
+Precondition:   reader is open
+Postcondition:  in correct operation, token points to the null terminated
+                text up to the stop character and the reader is positioned
+                after the stop character
+Exceptions:     returns the same codes as getLineTo - incomplete file error
+                if the file ends first, input buffer overrun error if
+                bufferSize - 1 printable characters come before the stop
+                character
+Notes: token stays valid until the next reader call; non printable
+       characters inside the token are dropped, as getLineTo does
+ */
+int getReaderToken( MetaDataReader *reader, int bufferSize, char stopChar,
+                                                            char **token )
+{
+    // initialize function/variables
+    int scanIndex, sourceIndex, destIndex;
+    int printableCount = 0;
+    Boolean hasControlChar = False;
+    unsigned char testChar;
+
+    // consume leading white space
+    while( True )
+    {
+        // check for end of the buffered bytes
+            // func: fillReaderBuffer
+        if( reader->position == reader->size
+                                    && fillReaderBuffer( reader ) == False )
+        {
+            // return incomplete file error
+            return INCOMPLETE_FILE_ERR;
+        }
+
+        testChar = reader->buffer[ reader->position ];
+        if( testChar == (unsigned char) stopChar
+                                    || testChar > (unsigned char) SPACE )
+        {
+            break;
+        }
+        reader->position++;
+    }
+
+    // scan to the stop character
+    scanIndex = reader->position;
+    while( True )
+    {
+        // check for end of the buffered bytes
+        if( scanIndex == reader->size )
+        {
+            // keep the scan index relative to the moved token
+                // func: fillReaderBuffer
+            scanIndex -= reader->position;
+            if( fillReaderBuffer( reader ) == False )
+            {
+                // return incomplete file error
+                return INCOMPLETE_FILE_ERR;
+            }
+        }
+
+        testChar = reader->buffer[ scanIndex ];
+        if( testChar == (unsigned char) stopChar )
+        {
+            break;
+        }
+
+        // count printable characters against the buffer size
+        if( testChar >= (unsigned char) SPACE )
+        {
+            printableCount++;
+        }
+        else
+        {
+            hasControlChar = True;
+        }
+
+        // check for buffer overrun
+        if( printableCount == bufferSize - 1 )
+        {
+            // return buffer overrun error
+            return INPUT_BUFFER_OVERRUN_ERR;
+        }
+        scanIndex++;
+    }
+
+    // terminate the token in place
+    reader->buffer[ scanIndex ] = NULL_CHAR;
+
+    // check for non printable characters to squeeze out
+    if( hasControlChar == True )
+    {
+        destIndex = reader->position;
+        for( sourceIndex = reader->position; sourceIndex < scanIndex;
+                                                                sourceIndex++ )
+        {
+            if( (unsigned char) reader->buffer[ sourceIndex ]
+                                                    >= (unsigned char) SPACE )
+            {
+                reader->buffer[ destIndex ] = reader->buffer[ sourceIndex ];
+                destIndex++;
+            }
+        }
+        reader->buffer[ destIndex ] = NULL_CHAR;
+    }
+
+    // return token, move past the stop character
+    *token = reader->buffer + reader->position;
+    reader->position = scanIndex + 1;
+
+    // return success
+    return NO_ERR;
+}
+
+/*
+Function Name:  seekMetaDataReader
+Algorithm:      moves the file to the offset and empties the block buffer
+Precondition:   reader is open, offset is inside the file
+Postcondition:  the next token is read from the offset
+Exceptions:     none
+Notes: none
+ */
+void seekMetaDataReader( MetaDataReader *reader, long offset )
+{
+    // move file position
+        // func: lseek, fileno
+    lseek( fileno( reader->filePtr ), offset, SEEK_SET );
+
+    // drop buffered bytes
+    reader->fileOffset = offset;
+    reader->size = 0;
+    reader->position = 0;
+}
+
+/*
+Function Name:  getReaderOffset
+Algorithm:      adds the reader position to the file offset of the buffer
+Precondition:   reader is open
+Postcondition:  returns file offset of the next unread byte
+Exceptions:     none
+Notes: none
+ */
+long getReaderOffset( MetaDataReader *reader )
+{
+    return reader->fileOffset + reader->position;
+}
+
+/*
+Function Name:  skipReaderPast
+Algorithm:      discards bytes up to and including the stop character
+Precondition:   reader is open
+Postcondition:  reader is positioned after the stop character
+Exceptions:     returns false if the file ends first
+Notes: none
+ */
+Boolean skipReaderPast( MetaDataReader *reader, char stopChar )
+{
+    // initialize function/variables
+    char *found;
+
+    // loop across buffered blocks
+    while( True )
+    {
+        // check for end of the buffered bytes
+            // func: fillReaderBuffer
+        if( reader->position == reader->size
+                                    && fillReaderBuffer( reader ) == False )
+        {
+            // return stop character not found
+            return False;
+        }
+
+        // look for the stop character in the buffered bytes
+            // func: memchr
+        found = ( char * ) memchr( reader->buffer + reader->position,
+                                stopChar, reader->size - reader->position );
+        if( found != NULL )
+        {
+            // move past stop character
+            reader->position = ( int ) ( found - reader->buffer ) + 1;
+            return True;
+        }
+        reader->position = reader->size;
+    }
+}
+
+/*
+Function Name:  closeMetaDataReader
+Algorithm:      closes file, releases block buffer
+Precondition:   reader is open
+Postcondition:  file is closed, buffer memory is returned to OS
+Exceptions:     none
+Notes: none
+ */
+void closeMetaDataReader( MetaDataReader *reader )
+{
+    // close file
+        // func: fclose
+    fclose( reader->filePtr );
+
+    // release buffer
+        // func: free
+    free( reader->buffer );
+    reader->buffer = NULL;
+}
+
 /*
 Function Name:  updateStartCount
 Algorithm:      updates number of "start" op commands found in file
-Precondition:   count >= 0, op string has "start" or other op name
-Postcondition:  if op string has "start", input count + 1 is returned;
+Precondition:   count >= 0, op name is "start" or other op name code
+Postcondition:  if op name is "start", input count + 1 is returned;
                 otherwise, input count is returned unchanged
 Exceptions:     none
 Notes: none
  */
-int updateStartCount( int count, char *opString )
+int updateStartCount( int count, int opName )
 {
-    // check for "start" in op string
-        // func: compareString
-    if( compareString( opString, "start") == STR_EQ )
+    // check for "start" op name
+    if( opName == OP_START_CODE )
     {
         // return incremented start count
         return count + 1;
@@ -353,17 +913,16 @@ int updateStartCount( int count, char *opString )
 /*
 Function Name:  updateEndCount
 Algorithm:      updates number of "end" op commands found in file
-Precondition:   count >= 0, op string has "end" or other op name
-Postcondition:  if op string has "end", input count + 1 is returned;
+Precondition:   count >= 0, op name is "end" or other op name code
+Postcondition:  if op name is "end", input count + 1 is returned;
                 otherwise, input count is returned unchanged
 Exceptions:     none
 Notes: none
  */
-int updateEndCount( int count, char *opString )
+int updateEndCount( int count, int opName )
 {
-    // check for "end" in op string
-        // func: compareString
-    if( compareString( opString, "end") == STR_EQ )
+    // check for "end" op name
+    if( opName == OP_END_CODE )
     {
         // return incremented end count
         return count + 1;
@@ -375,40 +934,58 @@ int updateEndCount( int count, char *opString )
 
 /*
 Function Name:  addNode
-Algorithm:      adds op command structure with data to a linked list
-Precondition:   linked list pointer assigned to null or to one op command link,
+Algorithm:      copies op command structure data to the end of the op code
+                vector, doubling the vector when it is full
+Precondition:   list is empty or holds earlier op commands,
                 struct pointer assigned to op command struct data
-Postcondition:  assigns new structure node to beginning of linked list
-                or end of established linked list
+Postcondition:  new op command is the last element of the vector
 Exceptions:     none
-Notes: assumes memory access/availability
+Notes: assumes memory access/availability; amortized O(1)
  */
-OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode )
+void addNode( OpCodeList *list, OpCodeType *newNode )
 {
-    // check for local ptr assigned to null
-    if( localPtr == NULL )
-    {
-        // access memory for new link/node
-            // func: malloc
-        localPtr = ( OpCodeType * ) malloc( sizeof( OpCodeType ) );
-        // assign all three values to newly created node
-        // assign next pointer to null
-            // func: copyString
-        localPtr->opLtr = newNode->opLtr;
-        copyString( localPtr->opName, newNode->opName );
-        localPtr->opValue = newNode->opValue;
-        localPtr->next = NULL;
-
-        // return current local pointer
-        return localPtr;
-    }
-    // assume end of list not found yet
-    // assign recursive function to current's next link
-        // function: addNode
-    localPtr->next = addNode( localPtr->next, newNode );
-
-    // return current local pointer
-    return localPtr;
+    // check for full vector
+    if( list->count == list->capacity )
+    {
+        // grow the vector
+            // func: realloc
+        list->capacity = ( list->capacity == 0 ) ? INITIAL_OP_CAPACITY
+                                                 : list->capacity * 2;
+        list->ops = ( OpCodeType * ) realloc( list->ops,
+                                    list->capacity * sizeof( OpCodeType ) );
+    }
+
+    // copy new node to the end of the vector
+    list->ops[ list->count ] = *newNode;
+    list->count++;
+}
+
+/*
+Function Name:  finishOpCodeList
+Algorithm:      trims the vector to its used size
+Precondition:   list holds all op commands of the file, ending with S(end)
+Postcondition:  returns first op code of the block, or null if the list
+                is empty
+Exceptions:     none
+Notes: none
+ */
+OpCodeType *finishOpCodeList( OpCodeList *list )
+{
+    // check for empty list
+    if( list->count == 0 )
+    {
+        // return empty list
+        return NULL;
+    }
+
+    // return unused capacity to the OS
+        // func: realloc
+    list->ops = ( OpCodeType * ) realloc( list->ops,
+                                        list->count * sizeof( OpCodeType ) );
+    list->capacity = list->count;
+
+    // return head of the list
+    return list->ops;
 }
 
 /*
@@ -425,23 +1002,51 @@ Notes: none
 Boolean checkOpString( char *testStr )
 {
     // check for all possible op names
-        //func: compareString
-    if( compareString( testStr, "access" )      == STR_EQ
-     || compareString( testStr, "allocate" )    == STR_EQ
-     || compareString( testStr, "end" )         == STR_EQ
-     || compareString( testStr, "hard drive" )  == STR_EQ
-     || compareString( testStr, "keyboard" )    == STR_EQ
-     || compareString( testStr, "printer" )     == STR_EQ
-     || compareString( testStr, "monitor" )     == STR_EQ
-     || compareString( testStr, "run" )         == STR_EQ
-     || compareString( testStr, "start" )       == STR_EQ )
-    {
-        // return found - true
-        return True;
+        //func: getOpNameCode
+    return ( getOpNameCode( testStr ) != OP_INVALID_CODE );
+}
+
+/*
+Function Name:  getOpNameCode
+Algorithm:      looks up tested op string in the op name hash table
+Precondition:   tested op string is correct C-Style string with potential
+                op command name in it
+Postcondition:  returns the OpNameCodes value of the name
+Exceptions:     returns OP_INVALID_CODE if the name is not an op name
+Notes: none
+ */
+int getOpNameCode( char *testStr )
+{
+    // initialize function/variables
+
+        // look up op name
+            // func: lookupKeyword
+        int code = lookupKeyword( &opNameTable, testStr );
+
+    // check for unknown name
+    if( code == KEYWORD_NOT_FOUND )
+    {
+        // return failure
+        return OP_INVALID_CODE;
     }
 
-    // return failure - false
-    return False;
+    // return found code
+    return code;
+}
+
+/*
+Function Name:  opNameToString
+Algorithm:      utility function to support display of op names
+Precondition:   op name holds a value from OpNameCodes
+Postcondition:  string parameter holds the op name as written in metadata
+Exceptions:     none
+Notes: none
+ */
+void opNameToString( int opName, char *outString )
+{
+    // copy string to return paramter
+        //func: copyString
+    copyString( outString, opNameStrings[ opName ] );
 }
 
 /*
@@ -468,9 +1073,9 @@ Boolean isDigit( char testChar )
 
 /*
 Function Name:  displayMetaData
-Algorithm:      iterates through op code linked list,
+Algorithm:      iterates through op code block up to S(end),
                 displays op code data individually
-Precondition:   linked list, with or without data
+Precondition:   op code block, with or without data
                 (should not be called if no data)
 Postcondition:  displays all op codes in list
 Exceptions:     none
@@ -482,8 +1087,12 @@ void displayMetaData( OpCodeType *localPtr )
         // func: printf
     printf( "\nMeta-Data File Display\n" );
     printf( "======================\n\n" );
-    // loop to end of linked list
-    while( localPtr != NULL )
+    // initialize function/variables
+    char nameString[ STD_STR_LEN ];
+    Boolean lastOpFound = ( localPtr == NULL );
+
+    // loop to end of op code block
+    while( lastOpFound == False )
     {
         // print op code letter
             // func: printf
@@ -491,14 +1100,18 @@ void displayMetaData( OpCodeType *localPtr )
 
         // print op code name
             // func: printf
-        printf( "Op code name: %s\n", localPtr->opName );
+            // func: opNameToString
+        opNameToString( localPtr->opName, nameString );
+        printf( "Op code name: %s\n", nameString );
 
         // print op code value
             // func: printf
         printf( "Op code value: %d\n\n", localPtr->opValue);
 
-        // assign local pointer to next node
-        localPtr = localPtr->next;
+        // check for S(end), assign local pointer to next op code
+        lastOpFound = ( localPtr->opLtr == 'S'
+                                    && localPtr->opName == OP_END_CODE );
+        localPtr++;
     }
 }
 
@@ -513,9 +1126,9 @@ Notes: none
  */
 void displayMetaDataError( int code )
 {
-    // create string error list, 10 items, max 35 letters
+    // create string error list, 13 items, max 35 letters
     // includes 3 errors from StringManipError
-    char errorList[ 10 ][ 35 ] =
+    char errorList[ 13 ][ 35 ] =
                     { "No Error",
                       "Incomplete File Error",
                       "Input Buffer Overrun",
@@ -525,7 +1138,10 @@ void displayMetaDataError( int code )
                       "Corrupt Op Command Letter Error",
                       "Corrupt Op Command Name Error",
                       "Corrupt Op Command Value Error",
-                      "Unbalanced Start-End Code Error" };
+                      "Unbalanced Start-End Code Error",
+                      "Complete Op Command Found",
+                      "Last Op Command Found",
+                      "Corrupt MD Image Error" };
 
     // display error to monitor with selected error string
         // func: printf
@@ -534,38 +1150,19 @@ void displayMetaDataError( int code )
 
 /*
 Function Name:  clearMetaDataList
-Algorithm:      recursively iterates through op code linked list,
-                returns memory to OS from the bottom of the list upward
-Precondition:   linked list, with or without data
+Algorithm:      returns the op code block to the OS
+Precondition:   head of an op code list from getOpCodes, or null
 Postcondition:  all node memory, if any, is returned to OS,
                 reutrn pointer (head) is set to null
 Exceptions:     none
-Notes: none
+Notes: every op code shares one allocation, so one free releases them all
  */
 OpCodeType *clearMetaDataList( OpCodeType *localPtr )
 {
-    // check for local pointer not set to null (list not empty)
-    if( localPtr != NULL )
-    {
-        // check for lcoal pointer's next node not null
-        if( localPtr->next != NULL )
-        {
-            // call recursive function with next pointer
-                // func: clearMetaDataList
-            clearMetaDataList( localPtr->next );
-        }
-
-        // after recursive call, release memory to OS
-            // func: free
-        free( localPtr );
-    }
+    // release memory to OS
+        // func: free
+    free( localPtr );
 
     // return null to calling function
     return NULL;
 }
-
-
-
-
-
-
@@ -3,11 +3,15 @@
 #define META_DATA_ACCESS_H
 
 // header files
+#include <pthread.h>
 #include <stdio.h> // for file access
 #include "StringUtils.h"
 
 //global constants
 
+// metadata file name that reads the metadata from standard input
+#define STDIN_FILE_NAME "-"
+
 typedef enum {  MD_FILE_ACCESS_ERR = 3,
                 MD_CORRUPT_DESCRIPTOR_ERR,
                 OPCMD_ACCESS_ERR,
@@ -16,26 +20,91 @@ typedef enum {  MD_FILE_ACCESS_ERR = 3,
                 CORRUPT_OPCMD_VALUE_ERR,
                 UNBALANCED_START_END_ERR,
                 COMPLETE_OPCMD_FOUND_MSG,
-                LAST_OPCMD_FOUND_MSG } OpCodeMessages;
+                LAST_OPCMD_FOUND_MSG,
+                MD_CORRUPT_IMAGE_ERR } OpCodeMessages;
+
+// buffered metadata reader
+// tokens are cut out of the block buffer in place
+typedef struct MetaDataReader
+{
+    FILE *filePtr;
+    long fileOffset;  // file offset of the first buffered byte
+    char *buffer;
+    int capacity;
+    int size;
+    int position;
+} MetaDataReader;
+
+// op code names, interned at parse time
+typedef enum {  OP_ACCESS_CODE,
+                OP_ALLOCATE_CODE,
+                OP_END_CODE,
+                OP_HARD_DRIVE_CODE,
+                OP_KEYBOARD_CODE,
+                OP_PRINTER_CODE,
+                OP_MONITOR_CODE,
+                OP_RUN_CODE,
+                OP_START_CODE,
+                OP_INVALID_CODE } OpNameCodes;
 
 // op code data structure
+// op codes are stored back to back in one block, ending with S(end),
+// so the next op code is always the following element; 8 bytes each,
+// with process timing kept in the burst table rather than per op code
 typedef struct OpCodeType
 {
     char opLtr;
-    char opName[ 100 ];  // length of op name - 99 characters
+    unsigned char opName;  // OpNameCodes value
     int opValue;
-    int timeRemaining;
-
-    struct OpCodeType *next;
 } OpCodeType;
 
+// growable vector the op codes are parsed into
+typedef struct OpCodeList
+{
+    OpCodeType *ops;
+    int count;
+    int capacity;
+} OpCodeList;
+
+// one byte range of the op stream, parsed on its own thread
+// the chunk owns the op commands that begin inside its range
+typedef struct OpCodeChunk
+{
+    char *fileName;
+    long startOffset;
+    long endOffset;
+    MetaDataReader reader;
+    OpCodeList list;
+    int startCount;
+    int endCount;
+    int result;
+    OpCodeType *destination;
+    pthread_t thread;
+} OpCodeChunk;
+
 //function prototypes
 int getOpCodes( char *fileName, OpCodeType **opCodeDataHead );
-int getOpCommand( FILE *filePtr, OpCodeType *inData );
-int updateStartCount( int count, char *opString );
-int updateEndCount( int count, char *opString );
-OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode );
+int getParseChunkCount( long bodySize );
+void parseOpChunk( OpCodeChunk *chunk );
+void *parseChunkThread( void *chunkPtr );
+void mergeOpChunks( OpCodeChunk *chunks, int lastChunk, int opCount );
+void *copyChunkThread( void *chunkPtr );
+int getOpCommand( MetaDataReader *reader, OpCodeType *inData );
+Boolean openMetaDataReader( char *fileName, MetaDataReader *reader );
+Boolean fillReaderBuffer( MetaDataReader *reader );
+int getReaderToken( MetaDataReader *reader, int bufferSize, char stopChar,
+                                                            char **token );
+void seekMetaDataReader( MetaDataReader *reader, long offset );
+long getReaderOffset( MetaDataReader *reader );
+Boolean skipReaderPast( MetaDataReader *reader, char stopChar );
+void closeMetaDataReader( MetaDataReader *reader );
+int updateStartCount( int count, int opName );
+int updateEndCount( int count, int opName );
+void addNode( OpCodeList *list, OpCodeType *newNode );
+OpCodeType *finishOpCodeList( OpCodeList *list );
 Boolean checkOpString( char *testStr );
+int getOpNameCode( char *testStr );
+void opNameToString( int opName, char *outString );
 Boolean isDigit( char testChar );
 void displayMetaData( OpCodeType *localPtr );
 void displayMetaDataError( int code );
@@ -0,0 +1,384 @@
+// Header files
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MetaDataImage.h"
+
+// First bytes of every image file
+static const char MD_IMAGE_MAGIC[8] = "SIMMDIMG";
+
+// Reads back as this value only in the byte order the image was written in
+static const uint32_t MD_IMAGE_BYTE_ORDER = 0x01020304;
+
+// Op codes staged per fwrite when writing an image
+#define IMAGE_WRITE_BLOCK 1024
+
+// Largest op value the text parser reads, nine digits
+#define MAX_IMAGE_OP_VALUE 999999999
+
+/**
+ * @brief Checks whether a metadata file is a precompiled image.
+ *
+ * @param[in] fileName Metadata file
+ *
+ * @return Boolean Returns True if the file starts with the image magic
+ */
+Boolean isMetaDataImage(char *fileName)
+{
+    FILE *filePtr = fopen(fileName, "rb");
+    char magic[sizeof(MD_IMAGE_MAGIC)];
+    Boolean isImage = False;
+
+    if (filePtr == NULL)
+    {
+        return False;
+    }
+    if (fread(magic, 1, sizeof(magic), filePtr) == sizeof(magic)
+        && memcmp(magic, MD_IMAGE_MAGIC, sizeof(magic)) == 0)
+    {
+        isImage = True;
+    }
+    fclose(filePtr);
+    return isImage;
+}
+
+/**
+ * @details Checks the header against this build and the file size, that
+ *          every op code could have come from the text parser and the
+ *          last is S(end), and that every index entry spans an A(start)
+ *          through an A(end) with cycle sums matching its op codes. One
+ *          pass over the op codes and one over each entry's, in place.
+ *
+ * @param[in] header Mapped image header
+ *
+ * @param[in] fileSize Size of the image file
+ *
+ * @return Boolean Returns True if the image can be used in place
+ */
+static Boolean checkImageLayout(MetaDataImageHeader *header, uint64_t fileSize)
+{
+    char *base = (char *)header;
+    OpCodeType *ops;
+    ProcessIndexEntry *processIndex;
+    ProcessIndexEntry *entry;
+    OpCodeType *firstOp;
+    OpCodeType *lastOp;
+    OpCodeType *op;
+    uint64_t runCycles;
+    uint64_t ioCycles;
+    uint32_t index;
+
+    if (memcmp(header->magic, MD_IMAGE_MAGIC, sizeof(MD_IMAGE_MAGIC)) != 0
+        || header->version != MD_IMAGE_VERSION
+        || header->byteOrder != MD_IMAGE_BYTE_ORDER
+        || header->opSize != sizeof(OpCodeType)
+        || header->entrySize != sizeof(ProcessIndexEntry)
+        || header->opCount == 0
+        || header->indexOffset % sizeof(uint64_t) != 0
+        || header->opOffset % sizeof(uint64_t) != 0
+        || header->indexOffset > fileSize
+        || header->opOffset > fileSize
+        || (uint64_t)header->processCount * sizeof(ProcessIndexEntry)
+               > fileSize - header->indexOffset
+        || (uint64_t)header->opCount * sizeof(OpCodeType)
+               > fileSize - header->opOffset)
+    {
+        return False;
+    }
+
+    ops = (OpCodeType *)(base + header->opOffset);
+    for (index = 0; index < header->opCount; index++)
+    {
+        op = &ops[index];
+        if (strchr("SAPMIO", op->opLtr) == NULL || op->opLtr == '\0'
+            || op->opName >= OP_INVALID_CODE
+            || op->opValue < 0 || op->opValue > MAX_IMAGE_OP_VALUE)
+        {
+            return False;
+        }
+    }
+
+    lastOp = &ops[header->opCount - 1];
+    if (lastOp->opLtr != 'S' || lastOp->opName != OP_END_CODE)
+    {
+        return False;
+    }
+
+    processIndex = (ProcessIndexEntry *)(base + header->indexOffset);
+    for (index = 0; index < header->processCount; index++)
+    {
+        entry = &processIndex[index];
+        if (entry->firstOp >= header->opCount
+            || entry->opCount == 0
+            || entry->opCount > header->opCount - entry->firstOp)
+        {
+            return False;
+        }
+        firstOp = &ops[entry->firstOp];
+        lastOp = &ops[entry->firstOp + entry->opCount - 1];
+        if (firstOp->opLtr != 'A' || firstOp->opName != OP_START_CODE
+            || lastOp->opLtr != 'A' || lastOp->opName != OP_END_CODE)
+        {
+            return False;
+        }
+
+        // Sums follow the rules of buildProcessIndex
+        runCycles = 0;
+        ioCycles = 0;
+        for (op = firstOp + 1; op <= lastOp; op++)
+        {
+            if (op->opLtr == 'P')
+            {
+                runCycles += op->opValue;
+            }
+            else if (op->opLtr != 'S' && op->opLtr != 'M')
+            {
+                ioCycles += op->opValue;
+            }
+        }
+        if (entry->runCycles != runCycles || entry->ioCycles != ioCycles)
+        {
+            return False;
+        }
+    }
+    return True;
+}
+
+/**
+ * @brief Maps a precompiled metadata image.
+ *
+ * @details The mapping is private and writable, so the simulator can
+ *          update op codes in place without touching the file. Nothing
+ *          is parsed or allocated per op code.
+ *
+ * @param[in] fileName Image file
+ *
+ * @param[out] image Loaded image
+ *
+ * @return int NO_ERR, MD_FILE_ACCESS_ERR, or MD_CORRUPT_IMAGE_ERR
+ */
+int loadMetaDataImage(char *fileName, MetaDataImage *image)
+{
+    MetaDataImageHeader *header;
+    struct stat fileInfo;
+    void *mapping;
+    int fileDesc;
+
+    image->mapping = NULL;
+    image->mappingSize = 0;
+    image->ops = NULL;
+    image->processIndex = NULL;
+    image->processCount = 0;
+
+    fileDesc = open(fileName, O_RDONLY);
+    if (fileDesc < 0)
+    {
+        return MD_FILE_ACCESS_ERR;
+    }
+    if (fstat(fileDesc, &fileInfo) != 0
+        || (uint64_t)fileInfo.st_size < sizeof(MetaDataImageHeader))
+    {
+        close(fileDesc);
+        return MD_CORRUPT_IMAGE_ERR;
+    }
+
+    mapping = mmap(NULL, (size_t)fileInfo.st_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE, fileDesc, 0);
+    close(fileDesc);
+    if (mapping == MAP_FAILED)
+    {
+        return MD_FILE_ACCESS_ERR;
+    }
+    image->mapping = mapping;
+    image->mappingSize = (size_t)fileInfo.st_size;
+
+    header = (MetaDataImageHeader *)mapping;
+    if (!checkImageLayout(header, (uint64_t)fileInfo.st_size))
+    {
+        closeMetaDataImage(image);
+        return MD_CORRUPT_IMAGE_ERR;
+    }
+
+    image->ops = (OpCodeType *)((char *)mapping + header->opOffset);
+    image->processIndex = (ProcessIndexEntry *)((char *)mapping + header->indexOffset);
+    image->processCount = (int)header->processCount;
+    return NO_ERR;
+}
+
+/**
+ * @brief Unmaps a metadata image.
+ *
+ * @param[in] image Image from loadMetaDataImage
+ */
+void closeMetaDataImage(MetaDataImage *image)
+{
+    if (image->mapping != NULL)
+    {
+        munmap(image->mapping, image->mappingSize);
+    }
+    image->mapping = NULL;
+    image->ops = NULL;
+    image->processIndex = NULL;
+    image->processCount = 0;
+}
+
+/**
+ * @brief Builds the process index of an op code block.
+ *
+ * @details Walks the op codes once the way createProcesses does, starting
+ *          an entry at each A(start), summing the cycles it would time, and
+ *          closing the entry at the matching A(end).
+ *
+ * @param[in] opCodes Op code block, starting at S(start) and ending with
+ *                    S(end)
+ *
+ * @param[out] processIndex Allocated index, freed by the caller
+ *
+ * @param[out] processCount Number of index entries
+ *
+ * @return int Number of op codes, including S(end)
+ */
+int buildProcessIndex(OpCodeType *opCodes, ProcessIndexEntry **processIndex,
+                      int *processCount)
+{
+    ProcessIndexEntry *entry = NULL;
+    int capacity = 0;
+    int opIndex;
+
+    *processIndex = NULL;
+    *processCount = 0;
+
+    for (opIndex = 0; !(opCodes[opIndex].opLtr == 'S'
+                        && opCodes[opIndex].opName == OP_END_CODE); opIndex++)
+    {
+        if (opCodes[opIndex].opLtr == 'A' && opCodes[opIndex].opName == OP_START_CODE)
+        {
+            if (*processCount == capacity)
+            {
+                capacity = (capacity == 0) ? 64 : capacity * 2;
+                *processIndex = (ProcessIndexEntry *)realloc(*processIndex,
+                                    capacity * sizeof(ProcessIndexEntry));
+            }
+            entry = &(*processIndex)[*processCount];
+            (*processCount)++;
+
+            entry->firstOp = opIndex;
+            entry->opCount = 0;
+            entry->runCycles = 0;
+            entry->ioCycles = 0;
+        }
+        // Op codes outside a process and M ops are never timed
+        else if (entry != NULL && opCodes[opIndex].opLtr != 'S'
+                 && opCodes[opIndex].opLtr != 'M')
+        {
+            if (opCodes[opIndex].opLtr == 'P')
+            {
+                entry->runCycles += opCodes[opIndex].opValue;
+            }
+            else
+            {
+                entry->ioCycles += opCodes[opIndex].opValue;
+            }
+
+            // A(end) closes the process
+            if (opCodes[opIndex].opLtr == 'A')
+            {
+                entry->opCount = opIndex - entry->firstOp + 1;
+            }
+        }
+    }
+
+    return opIndex + 1;
+}
+
+/**
+ * @details Parsed fields are copied into a zeroed staging block before
+ *          writing, so struct padding never reaches the file and the same
+ *          metadata always compiles to the same image.
+ *
+ * @param[in] filePtr Image file, positioned at the op codes
+ *
+ * @param[in] opCodes Op code block
+ *
+ * @param[in] opCount Number of op codes to write
+ *
+ * @return Boolean Returns True if every op code was written
+ */
+static Boolean writeImageOps(FILE *filePtr, OpCodeType *opCodes, int opCount)
+{
+    OpCodeType staging[IMAGE_WRITE_BLOCK];
+    int blockSize;
+    int index;
+
+    while (opCount > 0)
+    {
+        blockSize = (opCount < IMAGE_WRITE_BLOCK) ? opCount : IMAGE_WRITE_BLOCK;
+        memset(staging, 0, sizeof(staging));
+        for (index = 0; index < blockSize; index++)
+        {
+            staging[index].opLtr = opCodes[index].opLtr;
+            staging[index].opName = opCodes[index].opName;
+            staging[index].opValue = opCodes[index].opValue;
+        }
+        if (fwrite(staging, sizeof(OpCodeType), blockSize, filePtr) != (size_t)blockSize)
+        {
+            return False;
+        }
+        opCodes += blockSize;
+        opCount -= blockSize;
+    }
+    return True;
+}
+
+/**
+ * @brief Writes an op code block as a precompiled metadata image.
+ *
+ * @param[in] fileName Image file to create
+ *
+ * @param[in] opCodes Op code block from getOpCodes
+ *
+ * @return Boolean Returns True if the whole image was written
+ */
+Boolean writeMetaDataImage(char *fileName, OpCodeType *opCodes)
+{
+    MetaDataImageHeader header;
+    ProcessIndexEntry *processIndex;
+    int processCount;
+    int opCount = buildProcessIndex(opCodes, &processIndex, &processCount);
+    FILE *filePtr = fopen(fileName, "wb");
+    Boolean written;
+
+    if (filePtr == NULL)
+    {
+        free(processIndex);
+        return False;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MD_IMAGE_MAGIC, sizeof(MD_IMAGE_MAGIC));
+    header.version = MD_IMAGE_VERSION;
+    header.byteOrder = MD_IMAGE_BYTE_ORDER;
+    header.opSize = sizeof(OpCodeType);
+    header.entrySize = sizeof(ProcessIndexEntry);
+    header.opCount = opCount;
+    header.processCount = processCount;
+    header.indexOffset = sizeof(header);
+    header.opOffset = header.indexOffset
+                      + (uint64_t)processCount * sizeof(ProcessIndexEntry);
+
+    written = fwrite(&header, sizeof(header), 1, filePtr) == 1
+              && (processCount == 0
+                  || fwrite(processIndex, sizeof(ProcessIndexEntry), processCount,
+                            filePtr) == (size_t)processCount)
+              && writeImageOps(filePtr, opCodes, opCount);
+    if (fclose(filePtr) != 0)
+    {
+        written = False;
+    }
+
+    free(processIndex);
+    return written;
+}
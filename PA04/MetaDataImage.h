@@ -0,0 +1,59 @@
+// Pre-compiler directive
+#ifndef META_DATA_IMAGE_H
+#define META_DATA_IMAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "MetaDataAccess.h"
+
+// Image format version, bumped whenever the layout changes
+#define MD_IMAGE_VERSION 2
+
+// Precompiled metadata image header
+// Images are written in native byte order and op code layout; the
+// byteOrder, opSize, and entrySize fields reject images from another
+// build. The process index and op codes follow at their offsets
+typedef struct MetaDataImageHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t opSize;
+    uint32_t entrySize;
+    uint32_t opCount;
+    uint32_t processCount;
+    uint64_t indexOffset;
+    uint64_t opOffset;
+} MetaDataImageHeader;
+
+// Process index entry
+// Cycle sums cover every op code createProcesses times: P ops in
+// runCycles, the rest other than M ops and A(start) in ioCycles
+typedef struct ProcessIndexEntry
+{
+    uint32_t firstOp;  // index of the process's A(start)
+    uint32_t opCount;  // op codes from A(start) through A(end)
+    uint64_t runCycles;
+    uint64_t ioCycles;
+} ProcessIndexEntry;
+
+// Loaded image, op codes and index point into the private file mapping
+typedef struct MetaDataImage
+{
+    void *mapping;
+    size_t mappingSize;
+    OpCodeType *ops;
+    ProcessIndexEntry *processIndex;
+    int processCount;
+} MetaDataImage;
+
+// Function Prototypes
+Boolean isMetaDataImage(char *fileName);
+int loadMetaDataImage(char *fileName, MetaDataImage *image);
+void closeMetaDataImage(MetaDataImage *image);
+int buildProcessIndex(OpCodeType *opCodes, ProcessIndexEntry **processIndex,
+                      int *processCount);
+Boolean writeMetaDataImage(char *fileName, OpCodeType *opCodes);
+
+#endif // META_DATA_IMAGE_H
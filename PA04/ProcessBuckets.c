@@ -0,0 +1,222 @@
+// Header files
+#include "SimUtils.h"
+
+// Ages after which the stamps are rebased to keep them from overflowing,
+// a multiple of the bucket count so no process changes slot
+static const int AGE_REBASE_LIMIT = 1 << 30;
+
+/**
+ * @details Returns the slot a stamp is in: its own, or the slot of
+ *          bucket 0 once the buckets have aged past it.
+ */
+static int stampSlot(ProcessBuckets *buckets, int stamp)
+{
+    return ((stamp > buckets->age) ? stamp : buckets->age) & (PROCESS_BUCKET_COUNT - 1);
+}
+
+/**
+ * @details Restarts age at zero, lowering every stamp by the old age.
+ *          O(n), once every AGE_REBASE_LIMIT shifts.
+ */
+static void rebaseBuckets(ProcessBuckets *buckets)
+{
+    ProcessControlBlock *process;
+    int slot;
+
+    for (slot = 0; slot < PROCESS_BUCKET_COUNT; slot++)
+    {
+        for (process = buckets->heads[slot]; process != NULL;
+             process = process->nextInBucket)
+        {
+            process->bucket = ((process->bucket > buckets->age) ? process->bucket
+                                                                : buckets->age) - buckets->age;
+        }
+    }
+    buckets->age = 0;
+}
+
+/**
+ * @brief Initializes empty buckets.
+ *
+ * @param[out] buckets Buckets to initialize
+ */
+void initProcessBuckets(ProcessBuckets *buckets)
+{
+    int bucket;
+
+    for (bucket = 0; bucket < PROCESS_BUCKET_COUNT; bucket++)
+    {
+        buckets->heads[bucket] = NULL;
+        buckets->tails[bucket] = NULL;
+        buckets->sizes[bucket] = 0;
+    }
+    buckets->occupied = 0;
+    buckets->age = 0;
+    buckets->count = 0;
+}
+
+/**
+ * @details Links a process at the tail of a bucket. O(1).
+ *
+ * @param[in] buckets Process buckets
+ *
+ * @param[in] process Process not currently in any bucket
+ *
+ * @param[in] bucket Bucket index, 0 to PROCESS_BUCKET_COUNT - 1
+ */
+void bucketAppend(ProcessBuckets *buckets, ProcessControlBlock *process, int bucket)
+{
+    int slot = (buckets->age + bucket) & (PROCESS_BUCKET_COUNT - 1);
+
+    process->bucket = buckets->age + bucket;
+    process->prevInBucket = buckets->tails[slot];
+    process->nextInBucket = NULL;
+
+    if (buckets->tails[slot] == NULL)
+    {
+        buckets->heads[slot] = process;
+        buckets->occupied |= 1ULL << slot;
+    }
+    else
+    {
+        buckets->tails[slot]->nextInBucket = process;
+    }
+    buckets->tails[slot] = process;
+    buckets->sizes[slot]++;
+    buckets->count++;
+}
+
+/**
+ * @details Unlinks a process from its bucket. Removing a process that is
+ *          in no bucket does nothing. O(1).
+ *
+ * @param[in] buckets Process buckets
+ *
+ * @param[in] process Process to unlink
+ */
+void bucketRemove(ProcessBuckets *buckets, ProcessControlBlock *process)
+{
+    int slot;
+
+    if (process->bucket == NA)
+    {
+        return;
+    }
+    slot = stampSlot(buckets, process->bucket);
+
+    if (process->prevInBucket == NULL)
+    {
+        buckets->heads[slot] = process->nextInBucket;
+    }
+    else
+    {
+        process->prevInBucket->nextInBucket = process->nextInBucket;
+    }
+
+    if (process->nextInBucket == NULL)
+    {
+        buckets->tails[slot] = process->prevInBucket;
+    }
+    else
+    {
+        process->nextInBucket->prevInBucket = process->prevInBucket;
+    }
+
+    if (buckets->heads[slot] == NULL)
+    {
+        buckets->occupied &= ~(1ULL << slot);
+    }
+
+    process->bucket = NA;
+    process->prevInBucket = NULL;
+    process->nextInBucket = NULL;
+    buckets->sizes[slot]--;
+    buckets->count--;
+}
+
+/**
+ * @brief Moves every process down one bucket index.
+ *
+ * @details Bucket 0's list is spliced onto the front of bucket 1, so
+ *          processes keep their order, and age advances one slot, which
+ *          moves every other bucket down without visiting its processes.
+ *          The emptied slot becomes the last bucket. O(1), plus an O(n)
+ *          rebase once every AGE_REBASE_LIMIT shifts.
+ *
+ * @param[in] buckets Process buckets
+ *
+ * @return int Number of processes moved
+ */
+int bucketShiftDown(ProcessBuckets *buckets)
+{
+    int top = buckets->age & (PROCESS_BUCKET_COUNT - 1);
+    int next = (top + 1) & (PROCESS_BUCKET_COUNT - 1);
+    int moved = buckets->count - buckets->sizes[top];
+
+    if (buckets->heads[top] != NULL)
+    {
+        if (buckets->heads[next] == NULL)
+        {
+            buckets->tails[next] = buckets->tails[top];
+        }
+        else
+        {
+            buckets->tails[top]->nextInBucket = buckets->heads[next];
+            buckets->heads[next]->prevInBucket = buckets->tails[top];
+        }
+        buckets->heads[next] = buckets->heads[top];
+        buckets->sizes[next] += buckets->sizes[top];
+        buckets->heads[top] = NULL;
+        buckets->tails[top] = NULL;
+        buckets->sizes[top] = 0;
+        buckets->occupied = (buckets->occupied & ~(1ULL << top)) | (1ULL << next);
+    }
+
+    buckets->age++;
+    if (buckets->age == AGE_REBASE_LIMIT)
+    {
+        rebaseBuckets(buckets);
+    }
+    return moved;
+}
+
+/**
+ * @details Returns the bucket a process is in. O(1).
+ *
+ * @param[in] buckets Process buckets
+ *
+ * @param[in] process Process
+ *
+ * @return int Bucket index, NA if the process is in no bucket
+ */
+int bucketIndex(ProcessBuckets *buckets, ProcessControlBlock *process)
+{
+    if (process->bucket == NA)
+    {
+        return NA;
+    }
+    return (process->bucket > buckets->age) ? process->bucket - buckets->age : 0;
+}
+
+/**
+ * @details Returns the oldest process in the lowest non-empty bucket,
+ *          found from the lowest set bit of the occupancy map rotated to
+ *          start at bucket 0's slot. O(1).
+ *
+ * @param[in] buckets Process buckets
+ *
+ * @return ProcessControlBlock Next process, NULL if every bucket is empty
+ */
+ProcessControlBlock *bucketPeek(ProcessBuckets *buckets)
+{
+    int top = buckets->age & (PROCESS_BUCKET_COUNT - 1);
+    unsigned long long rotated;
+
+    if (buckets->occupied == 0)
+    {
+        return NULL;
+    }
+    rotated = (buckets->occupied >> top)
+              | (buckets->occupied << ((PROCESS_BUCKET_COUNT - top) & (PROCESS_BUCKET_COUNT - 1)));
+    return buckets->heads[(top + __builtin_ctzll(rotated)) & (PROCESS_BUCKET_COUNT - 1)];
+}
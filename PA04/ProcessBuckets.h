@@ -0,0 +1,36 @@
+// Pre-compiler directive
+#ifndef PROCESS_BUCKETS_H
+#define PROCESS_BUCKETS_H
+
+struct ProcessControlBlock;
+
+// Number of buckets, one bit each in the occupancy map
+#define PROCESS_BUCKET_COUNT 64
+
+// Bucketed FIFO of PCBs, lowest bucket dispatched first
+// Each bucket is linked through the PCB's bucket links, so a PCB is in at
+// most one bucket at a time. Buckets are a ring of slots starting at
+// slot age, so shifting every bucket down one only advances age. A PCB
+// records age plus its bucket when it joined in bucket, NA when not in
+// one, and sits in the slot of that stamp, or of age once age passes it.
+// Bit s of occupied is set while slot s is not empty
+typedef struct
+{
+    struct ProcessControlBlock *heads[PROCESS_BUCKET_COUNT];
+    struct ProcessControlBlock *tails[PROCESS_BUCKET_COUNT];
+    int sizes[PROCESS_BUCKET_COUNT];
+    unsigned long long occupied;
+    int age;
+    int count;
+} ProcessBuckets;
+
+// Function Prototypes
+void initProcessBuckets(ProcessBuckets *buckets);
+void bucketAppend(ProcessBuckets *buckets, struct ProcessControlBlock *process,
+                  int bucket);
+void bucketRemove(ProcessBuckets *buckets, struct ProcessControlBlock *process);
+int bucketShiftDown(ProcessBuckets *buckets);
+int bucketIndex(ProcessBuckets *buckets, struct ProcessControlBlock *process);
+struct ProcessControlBlock *bucketPeek(ProcessBuckets *buckets);
+
+#endif // PROCESS_BUCKETS_H
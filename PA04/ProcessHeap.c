@@ -0,0 +1,182 @@
+// Header files
+#include <stdlib.h>
+
+#include "SimUtils.h"
+
+// Initial number of processes the heap can hold before growing
+static const int INITIAL_HEAP_CAPACITY = 16;
+
+static void placeNode(ProcessHeap *heap, int index, ProcessControlBlock *process)
+{
+    heap->nodes[index] = process;
+    process->heapIndex = index;
+}
+
+static void siftUp(ProcessHeap *heap, int index)
+{
+    ProcessControlBlock *process = heap->nodes[index];
+    int parent;
+
+    while (index > 0)
+    {
+        parent = (index - 1) / 2;
+        if (heap->compare(process, heap->nodes[parent]) >= 0)
+        {
+            break;
+        }
+        placeNode(heap, index, heap->nodes[parent]);
+        index = parent;
+    }
+    placeNode(heap, index, process);
+}
+
+static void siftDown(ProcessHeap *heap, int index)
+{
+    ProcessControlBlock *process = heap->nodes[index];
+    int child;
+
+    while (True)
+    {
+        child = 2 * index + 1;
+        if (child >= heap->size)
+        {
+            break;
+        }
+        if ((child + 1 < heap->size) && (heap->compare(heap->nodes[child + 1], heap->nodes[child]) < 0))
+        {
+            child++;
+        }
+        if (heap->compare(heap->nodes[child], process) >= 0)
+        {
+            break;
+        }
+        placeNode(heap, index, heap->nodes[child]);
+        index = child;
+    }
+    placeNode(heap, index, process);
+}
+
+/**
+ * @brief Initializes an empty heap.
+ *
+ * @param[out] heap Heap to initialize
+ *
+ * @param[in] compare Ordering of the heap
+ */
+void initProcessHeap(ProcessHeap *heap, ProcessCompare compare)
+{
+    heap->nodes = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+    heap->compare = compare;
+}
+
+/**
+ * @brief Adds a process to the heap.
+ *
+ * @details Grows the node array as needed and sifts the process up
+ *          to its place. O(log n).
+ *
+ * @param[in] heap Process heap
+ *
+ * @param[in] process Process not currently in any heap
+ */
+void heapInsert(ProcessHeap *heap, ProcessControlBlock *process)
+{
+    if (heap->size == heap->capacity)
+    {
+        heap->capacity = (heap->capacity == 0) ? INITIAL_HEAP_CAPACITY
+                                               : heap->capacity * 2;
+        heap->nodes = (ProcessControlBlock **)realloc(heap->nodes,
+                                                      heap->capacity * sizeof(ProcessControlBlock *));
+    }
+    heap->size++;
+    placeNode(heap, heap->size - 1, process);
+    siftUp(heap, heap->size - 1);
+}
+
+/**
+ * @details Returns the process at the top of the heap without removing it.
+ *
+ * @param[in] heap Process heap
+ *
+ * @return ProcessControlBlock Minimum process, NULL if heap is empty
+ */
+ProcessControlBlock *heapPeek(ProcessHeap *heap)
+{
+    if (heap->size == 0)
+    {
+        return NULL;
+    }
+    return heap->nodes[0];
+}
+
+/**
+ * @details Removes an arbitrary process using its stored heap index.
+ *          O(log n). Does nothing if the process is not in the heap.
+ *
+ * @param[in] heap Process heap
+ *
+ * @param[in] process Process to remove
+ */
+void heapRemove(ProcessHeap *heap, ProcessControlBlock *process)
+{
+    int index = process->heapIndex;
+    ProcessControlBlock *last;
+
+    if (index < 0 || index >= heap->size || heap->nodes[index] != process)
+    {
+        return;
+    }
+
+    process->heapIndex = NA;
+    heap->size--;
+    if (index == heap->size)
+    {
+        return;
+    }
+
+    // Move the last node into the hole and restore order in either direction
+    last = heap->nodes[heap->size];
+    placeNode(heap, index, last);
+    siftUp(heap, index);
+    siftDown(heap, last->heapIndex);
+}
+
+/**
+ * @details Restores heap order after the process key was lowered,
+ *          such as timeRemaining during a run cycle. O(log n).
+ *
+ * @param[in] heap Process heap
+ *
+ * @param[in] process Process whose key decreased
+ */
+void heapDecreaseKey(ProcessHeap *heap, ProcessControlBlock *process)
+{
+    if (process->heapIndex >= 0 && process->heapIndex < heap->size)
+    {
+        siftUp(heap, process->heapIndex);
+    }
+}
+
+/**
+ * @brief Clears process heap.
+ *
+ * @details Returns the node array to the OS. The processes themselves
+ *          are owned by the PCB list.
+ *
+ * @param[in] heap Process heap
+ */
+void clearProcessHeap(ProcessHeap *heap)
+{
+    int index;
+
+    for (index = 0; index < heap->size; index++)
+    {
+        heap->nodes[index]->heapIndex = NA;
+    }
+    free(heap->nodes);
+    heap->nodes = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+}
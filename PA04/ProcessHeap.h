@@ -0,0 +1,29 @@
+// Pre-compiler directive
+#ifndef PROCESS_HEAP_H
+#define PROCESS_HEAP_H
+
+struct ProcessControlBlock;
+
+// Returns < 0 if the first process should be dispatched before the second
+typedef int (*ProcessCompare)(struct ProcessControlBlock *first,
+                              struct ProcessControlBlock *second);
+
+// Indexed binary min-heap of PCBs
+// Each PCB records its own slot in heapIndex, NA when not in a heap
+typedef struct
+{
+    struct ProcessControlBlock **nodes;
+    int size;
+    int capacity;
+    ProcessCompare compare;
+} ProcessHeap;
+
+// Function Prototypes
+void initProcessHeap(ProcessHeap *heap, ProcessCompare compare);
+void heapInsert(ProcessHeap *heap, struct ProcessControlBlock *process);
+struct ProcessControlBlock *heapPeek(ProcessHeap *heap);
+void heapRemove(ProcessHeap *heap, struct ProcessControlBlock *process);
+void heapDecreaseKey(ProcessHeap *heap, struct ProcessControlBlock *process);
+void clearProcessHeap(ProcessHeap *heap);
+
+#endif // PROCESS_HEAP_H
@@ -0,0 +1,82 @@
+// Header files
+#include "SimUtils.h"
+
+/**
+ * @brief Initializes an empty queue.
+ *
+ * @param[out] queue Queue to initialize
+ */
+void initProcessQueue(ProcessQueue *queue)
+{
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->count = 0;
+}
+
+/**
+ * @details Links a process at the tail of the queue. O(1).
+ *
+ * @param[in] queue Process queue
+ *
+ * @param[in] process Process not currently linked in any queue
+ */
+void queueAppend(ProcessQueue *queue, ProcessControlBlock *process)
+{
+    process->prevInQueue = queue->tail;
+    process->nextInQueue = NULL;
+
+    if (queue->tail == NULL)
+    {
+        queue->head = process;
+    }
+    else
+    {
+        queue->tail->nextInQueue = process;
+    }
+    queue->tail = process;
+    queue->count++;
+}
+
+/**
+ * @details Unlinks a process from anywhere in the queue. O(1).
+ *
+ * @param[in] queue Process queue the process is linked in
+ *
+ * @param[in] process Process to unlink
+ */
+void queueRemove(ProcessQueue *queue, ProcessControlBlock *process)
+{
+    if (process->prevInQueue == NULL)
+    {
+        queue->head = process->nextInQueue;
+    }
+    else
+    {
+        process->prevInQueue->nextInQueue = process->nextInQueue;
+    }
+
+    if (process->nextInQueue == NULL)
+    {
+        queue->tail = process->prevInQueue;
+    }
+    else
+    {
+        process->nextInQueue->prevInQueue = process->prevInQueue;
+    }
+
+    process->prevInQueue = NULL;
+    process->nextInQueue = NULL;
+    queue->count--;
+}
+
+/**
+ * @details Returns the process at the head of the queue without removing it.
+ *
+ * @param[in] queue Process queue
+ *
+ * @return ProcessControlBlock Oldest process, NULL if queue is empty
+ */
+ProcessControlBlock *queueFront(ProcessQueue *queue)
+{
+    return queue->head;
+}
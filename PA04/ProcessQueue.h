@@ -0,0 +1,22 @@
+// Pre-compiler directive
+#ifndef PROCESS_QUEUE_H
+#define PROCESS_QUEUE_H
+
+struct ProcessControlBlock;
+
+// Intrusive doubly-linked FIFO of PCBs
+// Links live in the PCB, so a PCB is in at most one queue at a time
+typedef struct
+{
+    struct ProcessControlBlock *head;
+    struct ProcessControlBlock *tail;
+    int count;
+} ProcessQueue;
+
+// Function Prototypes
+void initProcessQueue(ProcessQueue *queue);
+void queueAppend(ProcessQueue *queue, struct ProcessControlBlock *process);
+void queueRemove(ProcessQueue *queue, struct ProcessControlBlock *process);
+struct ProcessControlBlock *queueFront(ProcessQueue *queue);
+
+#endif // PROCESS_QUEUE_H
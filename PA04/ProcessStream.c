@@ -0,0 +1,230 @@
+// Header files
+#include <stdlib.h>
+
+#include "ProcessStream.h"
+
+/**
+ * @details Hands a finished process to the simulator, waiting while the
+ *          queue is full so a fast parser never holds more than
+ *          STREAM_QUEUE_CAPACITY processes.
+ *
+ * @param[in] stream Process stream
+ *
+ * @param[in] process Parsed process, owned by the stream from here on
+ *
+ * @return Boolean Returns False if the stream was cancelled instead
+ */
+static Boolean queueStreamedProcess(ProcessStream *stream, StreamedProcess *process)
+{
+    pthread_mutex_lock(&stream->lock);
+    while (stream->count == STREAM_QUEUE_CAPACITY && !stream->cancelled)
+    {
+        pthread_cond_wait(&stream->slotFree, &stream->lock);
+    }
+    if (stream->cancelled)
+    {
+        pthread_mutex_unlock(&stream->lock);
+        free(process->ops);
+        return False;
+    }
+
+    stream->queue[(stream->head + stream->count) % STREAM_QUEUE_CAPACITY] = *process;
+    stream->count++;
+    pthread_cond_signal(&stream->processReady);
+    pthread_mutex_unlock(&stream->lock);
+    return True;
+}
+
+/**
+ * @brief Metadata parser thread.
+ *
+ * @details Reads op commands as getOpCodes does, collecting each
+ *          A(start) through A(end) into its own block and queueing it
+ *          as soon as it is complete. The checks getOpCodes makes on the
+ *          whole file are made once S(end) is read, and their result is
+ *          reported when the stream closes.
+ *
+ * @param[in] streamPtr Process stream
+ */
+static void *parseStreamThread(void *streamPtr)
+{
+    ProcessStream *stream = (ProcessStream *)streamPtr;
+    OpCodeList process = {NULL, 0, 0};
+    StreamedProcess streamed;
+    OpCodeType newOp;
+    int accessResult = COMPLETE_OPCMD_FOUND_MSG;
+    int startCount = 0, endCount = 0, opCount = 0;
+    char *dataToken;
+    Boolean cancelled = False;
+
+    while (!cancelled)
+    {
+        accessResult = getOpCommand(&stream->reader, &newOp);
+        if (accessResult != COMPLETE_OPCMD_FOUND_MSG && accessResult != LAST_OPCMD_FOUND_MSG)
+        {
+            break;
+        }
+        opCount++;
+        startCount = updateStartCount(startCount, newOp.opName);
+        endCount = updateEndCount(endCount, newOp.opName);
+
+        // A(start) begins a new block, dropping any process left unfinished
+        if (newOp.opLtr == 'A' && newOp.opName == OP_START_CODE)
+        {
+            process.count = 0;
+            addNode(&process, &newOp);
+        }
+        // Op codes outside a process are never run
+        else if (process.count > 0)
+        {
+            addNode(&process, &newOp);
+            if (newOp.opLtr == 'A' && newOp.opName == OP_END_CODE)
+            {
+                streamed.ops = finishOpCodeList(&process);
+                cancelled = !queueStreamedProcess(stream, &streamed);
+
+                process.ops = NULL;
+                process.count = 0;
+                process.capacity = 0;
+            }
+        }
+
+        if (accessResult == LAST_OPCMD_FOUND_MSG)
+        {
+            break;
+        }
+    }
+    free(process.ops);
+
+    if (accessResult == LAST_OPCMD_FOUND_MSG && opCount > 1)
+    {
+        if (startCount != endCount)
+        {
+            accessResult = UNBALANCED_START_END_ERR;
+        }
+        else if (getReaderToken(&stream->reader, MAX_STR_LEN, PERIOD, &dataToken) != NO_ERR
+                 || compareString(dataToken, "End Program Meta-Data Code") != STR_EQ)
+        {
+            accessResult = MD_CORRUPT_DESCRIPTOR_ERR;
+        }
+        else
+        {
+            accessResult = NO_ERR;
+        }
+    }
+
+    pthread_mutex_lock(&stream->lock);
+    stream->finished = True;
+    stream->result = accessResult;
+    pthread_cond_broadcast(&stream->processReady);
+    pthread_mutex_unlock(&stream->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Starts parsing a metadata file into processes.
+ *
+ * @details The leader line is checked before the parser thread starts,
+ *          so a file that is not metadata fails here as it would in
+ *          getOpCodes. Later errors end the stream early.
+ *
+ * @param[out] stream Process stream to start
+ *
+ * @param[in] fileName Metadata file, STDIN_FILE_NAME for standard input
+ *
+ * @return int NO_ERR, MD_FILE_ACCESS_ERR, or MD_CORRUPT_DESCRIPTOR_ERR
+ */
+int openProcessStream(ProcessStream *stream, char *fileName)
+{
+    char *dataToken;
+
+    if (openMetaDataReader(fileName, &stream->reader) == False)
+    {
+        return MD_FILE_ACCESS_ERR;
+    }
+    if (getReaderToken(&stream->reader, MAX_STR_LEN, COLON, &dataToken) != NO_ERR
+        || compareString(dataToken, "Start Program Meta-Data Code") != STR_EQ)
+    {
+        closeMetaDataReader(&stream->reader);
+        return MD_CORRUPT_DESCRIPTOR_ERR;
+    }
+
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->processReady, NULL);
+    pthread_cond_init(&stream->slotFree, NULL);
+    stream->head = 0;
+    stream->count = 0;
+    stream->finished = False;
+    stream->cancelled = False;
+    stream->result = NO_ERR;
+
+    pthread_create(&stream->parser, NULL, parseStreamThread, stream);
+    return NO_ERR;
+}
+
+/**
+ * @brief Takes the next process in metadata order.
+ *
+ * @details Waits for the parser when no process is queued.
+ *
+ * @param[in] stream Process stream
+ *
+ * @param[out] process Next process; its op block now belongs to the caller
+ *
+ * @return Boolean Returns False once the stream has ended and every
+ *                 process has been taken
+ */
+Boolean takeStreamedProcess(ProcessStream *stream, StreamedProcess *process)
+{
+    pthread_mutex_lock(&stream->lock);
+    while (stream->count == 0 && !stream->finished)
+    {
+        pthread_cond_wait(&stream->processReady, &stream->lock);
+    }
+    if (stream->count == 0)
+    {
+        pthread_mutex_unlock(&stream->lock);
+        return False;
+    }
+
+    *process = stream->queue[stream->head];
+    stream->head = (stream->head + 1) % STREAM_QUEUE_CAPACITY;
+    stream->count--;
+    pthread_cond_signal(&stream->slotFree);
+    pthread_mutex_unlock(&stream->lock);
+    return True;
+}
+
+/**
+ * @brief Stops the parser and releases the stream.
+ *
+ * @details A parser still reading is cancelled at its next queued
+ *          process. Processes never taken are freed.
+ *
+ * @param[in] stream Process stream from openProcessStream
+ *
+ * @return int NO_ERR if the whole file was streamed, otherwise the
+ *             OpCodeMessages error that ended it
+ */
+int closeProcessStream(ProcessStream *stream)
+{
+    pthread_mutex_lock(&stream->lock);
+    stream->cancelled = True;
+    pthread_cond_broadcast(&stream->slotFree);
+    pthread_mutex_unlock(&stream->lock);
+    pthread_join(stream->parser, NULL);
+
+    while (stream->count > 0)
+    {
+        free(stream->queue[stream->head].ops);
+        stream->head = (stream->head + 1) % STREAM_QUEUE_CAPACITY;
+        stream->count--;
+    }
+
+    closeMetaDataReader(&stream->reader);
+    pthread_cond_destroy(&stream->slotFree);
+    pthread_cond_destroy(&stream->processReady);
+    pthread_mutex_destroy(&stream->lock);
+    return stream->result;
+}
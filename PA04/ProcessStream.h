@@ -0,0 +1,46 @@
+// Pre-compiler directive
+#ifndef PROCESS_STREAM_H
+#define PROCESS_STREAM_H
+
+#include <pthread.h>
+
+#include "MetaDataAccess.h"
+
+// Parsed processes the stream holds before the parser waits for the
+// simulator to take one
+#define STREAM_QUEUE_CAPACITY 256
+
+// Processes the simulator keeps admitted but not yet exited
+#define STREAM_PROCESS_WINDOW 1024
+
+// One process cut out of the op stream
+// ops is its own block, A(start) through A(end), owned by the taker
+typedef struct
+{
+    OpCodeType *ops;
+} StreamedProcess;
+
+// Metadata parsed on its own thread into a bounded process queue
+// The parser hands over each process as soon as its A(end) is read, so
+// the simulator can dispatch while the rest of the file is still coming
+typedef struct
+{
+    MetaDataReader reader;
+    pthread_t parser;
+    pthread_mutex_t lock;
+    pthread_cond_t processReady;
+    pthread_cond_t slotFree;
+    StreamedProcess queue[STREAM_QUEUE_CAPACITY];
+    int head;
+    int count;
+    Boolean finished;
+    Boolean cancelled;
+    int result;
+} ProcessStream;
+
+// Function Prototypes
+int openProcessStream(ProcessStream *stream, char *fileName);
+Boolean takeStreamedProcess(ProcessStream *stream, StreamedProcess *process);
+int closeProcessStream(ProcessStream *stream);
+
+#endif // PROCESS_STREAM_H
@@ -0,0 +1,352 @@
+// Header files
+#include "SimUtils.h"
+
+static Boolean isRed(ProcessControlBlock *process)
+{
+    return (process != NULL) && (process->treeColor == TREE_RED);
+}
+
+static void replaceChild(ProcessTree *tree, ProcessControlBlock *parent,
+                         ProcessControlBlock *oldChild, ProcessControlBlock *newChild)
+{
+    if (parent == NULL)
+    {
+        tree->root = newChild;
+    }
+    else if (parent->treeLeft == oldChild)
+    {
+        parent->treeLeft = newChild;
+    }
+    else
+    {
+        parent->treeRight = newChild;
+    }
+    if (newChild != NULL)
+    {
+        newChild->treeParent = parent;
+    }
+}
+
+static void rotateLeft(ProcessTree *tree, ProcessControlBlock *process)
+{
+    ProcessControlBlock *child = process->treeRight;
+
+    process->treeRight = child->treeLeft;
+    if (child->treeLeft != NULL)
+    {
+        child->treeLeft->treeParent = process;
+    }
+    replaceChild(tree, process->treeParent, process, child);
+    child->treeLeft = process;
+    process->treeParent = child;
+}
+
+static void rotateRight(ProcessTree *tree, ProcessControlBlock *process)
+{
+    ProcessControlBlock *child = process->treeLeft;
+
+    process->treeLeft = child->treeRight;
+    if (child->treeRight != NULL)
+    {
+        child->treeRight->treeParent = process;
+    }
+    replaceChild(tree, process->treeParent, process, child);
+    child->treeRight = process;
+    process->treeParent = child;
+}
+
+static void insertFixup(ProcessTree *tree, ProcessControlBlock *process)
+{
+    ProcessControlBlock *parent;
+    ProcessControlBlock *grandparent;
+    ProcessControlBlock *uncle;
+
+    while (isRed(process->treeParent))
+    {
+        parent = process->treeParent;
+        grandparent = parent->treeParent;
+
+        if (parent == grandparent->treeLeft)
+        {
+            uncle = grandparent->treeRight;
+            if (isRed(uncle))
+            {
+                parent->treeColor = TREE_BLACK;
+                uncle->treeColor = TREE_BLACK;
+                grandparent->treeColor = TREE_RED;
+                process = grandparent;
+                continue;
+            }
+            if (process == parent->treeRight)
+            {
+                rotateLeft(tree, parent);
+                process = parent;
+                parent = process->treeParent;
+            }
+            parent->treeColor = TREE_BLACK;
+            grandparent->treeColor = TREE_RED;
+            rotateRight(tree, grandparent);
+        }
+        else
+        {
+            uncle = grandparent->treeLeft;
+            if (isRed(uncle))
+            {
+                parent->treeColor = TREE_BLACK;
+                uncle->treeColor = TREE_BLACK;
+                grandparent->treeColor = TREE_RED;
+                process = grandparent;
+                continue;
+            }
+            if (process == parent->treeLeft)
+            {
+                rotateRight(tree, parent);
+                process = parent;
+                parent = process->treeParent;
+            }
+            parent->treeColor = TREE_BLACK;
+            grandparent->treeColor = TREE_RED;
+            rotateLeft(tree, grandparent);
+        }
+    }
+    tree->root->treeColor = TREE_BLACK;
+}
+
+// child took a black node's place under parent; child may be NULL
+static void removeFixup(ProcessTree *tree, ProcessControlBlock *child,
+                        ProcessControlBlock *parent)
+{
+    ProcessControlBlock *sibling;
+
+    while (child != tree->root && !isRed(child))
+    {
+        if (child == parent->treeLeft)
+        {
+            sibling = parent->treeRight;
+            if (isRed(sibling))
+            {
+                sibling->treeColor = TREE_BLACK;
+                parent->treeColor = TREE_RED;
+                rotateLeft(tree, parent);
+                sibling = parent->treeRight;
+            }
+            if (!isRed(sibling->treeLeft) && !isRed(sibling->treeRight))
+            {
+                sibling->treeColor = TREE_RED;
+                child = parent;
+                parent = child->treeParent;
+                continue;
+            }
+            if (!isRed(sibling->treeRight))
+            {
+                sibling->treeLeft->treeColor = TREE_BLACK;
+                sibling->treeColor = TREE_RED;
+                rotateRight(tree, sibling);
+                sibling = parent->treeRight;
+            }
+            sibling->treeColor = parent->treeColor;
+            parent->treeColor = TREE_BLACK;
+            sibling->treeRight->treeColor = TREE_BLACK;
+            rotateLeft(tree, parent);
+        }
+        else
+        {
+            sibling = parent->treeLeft;
+            if (isRed(sibling))
+            {
+                sibling->treeColor = TREE_BLACK;
+                parent->treeColor = TREE_RED;
+                rotateRight(tree, parent);
+                sibling = parent->treeLeft;
+            }
+            if (!isRed(sibling->treeLeft) && !isRed(sibling->treeRight))
+            {
+                sibling->treeColor = TREE_RED;
+                child = parent;
+                parent = child->treeParent;
+                continue;
+            }
+            if (!isRed(sibling->treeLeft))
+            {
+                sibling->treeRight->treeColor = TREE_BLACK;
+                sibling->treeColor = TREE_RED;
+                rotateLeft(tree, sibling);
+                sibling = parent->treeLeft;
+            }
+            sibling->treeColor = parent->treeColor;
+            parent->treeColor = TREE_BLACK;
+            sibling->treeLeft->treeColor = TREE_BLACK;
+            rotateRight(tree, parent);
+        }
+        child = tree->root;
+    }
+    if (child != NULL)
+    {
+        child->treeColor = TREE_BLACK;
+    }
+}
+
+/**
+ * @brief Initializes an empty tree.
+ *
+ * @param[out] tree Tree to initialize
+ *
+ * @param[in] compare Ordering of the tree
+ */
+void initProcessTree(ProcessTree *tree, ProcessCompare compare)
+{
+    tree->root = NULL;
+    tree->leftmost = NULL;
+    tree->count = 0;
+    tree->compare = compare;
+}
+
+/**
+ * @details Inserts a process, keeping the leftmost cache. O(log n).
+ *
+ * @param[in] tree Process tree
+ *
+ * @param[in] process Process not currently in the tree
+ */
+void treeInsert(ProcessTree *tree, ProcessControlBlock *process)
+{
+    ProcessControlBlock *parent = NULL;
+    ProcessControlBlock *node = tree->root;
+    Boolean leftmost = True;
+
+    while (node != NULL)
+    {
+        parent = node;
+        if (tree->compare(process, node) < 0)
+        {
+            node = node->treeLeft;
+        }
+        else
+        {
+            node = node->treeRight;
+            leftmost = False;
+        }
+    }
+
+    process->treeParent = parent;
+    process->treeLeft = NULL;
+    process->treeRight = NULL;
+    process->treeColor = TREE_RED;
+
+    if (parent == NULL)
+    {
+        tree->root = process;
+    }
+    else if (tree->compare(process, parent) < 0)
+    {
+        parent->treeLeft = process;
+    }
+    else
+    {
+        parent->treeRight = process;
+    }
+
+    if (leftmost)
+    {
+        tree->leftmost = process;
+    }
+    tree->count++;
+    insertFixup(tree, process);
+}
+
+/**
+ * @details Removes a process from anywhere in the tree. Removing a
+ *          process that is not in the tree does nothing. O(log n).
+ *
+ * @param[in] tree Process tree
+ *
+ * @param[in] process Process to remove
+ */
+void treeRemove(ProcessTree *tree, ProcessControlBlock *process)
+{
+    ProcessControlBlock *child;
+    ProcessControlBlock *parent;
+    ProcessControlBlock *successor;
+    int removedColor;
+
+    if (process->treeColor == NA)
+    {
+        return;
+    }
+
+    // The leftmost has no left child, so its successor is its right
+    // subtree's minimum or, failing that, its parent
+    if (tree->leftmost == process)
+    {
+        if (process->treeRight != NULL)
+        {
+            for (successor = process->treeRight; successor->treeLeft != NULL;
+                 successor = successor->treeLeft)
+            {
+            }
+            tree->leftmost = successor;
+        }
+        else
+        {
+            tree->leftmost = process->treeParent;
+        }
+    }
+
+    if (process->treeLeft == NULL || process->treeRight == NULL)
+    {
+        child = (process->treeLeft != NULL) ? process->treeLeft : process->treeRight;
+        parent = process->treeParent;
+        removedColor = process->treeColor;
+        replaceChild(tree, parent, process, child);
+    }
+    else
+    {
+        // Splice out the in-order successor and put it in the process's place
+        for (successor = process->treeRight; successor->treeLeft != NULL;
+             successor = successor->treeLeft)
+        {
+        }
+        removedColor = successor->treeColor;
+        child = successor->treeRight;
+
+        if (successor->treeParent == process)
+        {
+            parent = successor;
+        }
+        else
+        {
+            parent = successor->treeParent;
+            replaceChild(tree, parent, successor, child);
+            successor->treeRight = process->treeRight;
+            successor->treeRight->treeParent = successor;
+        }
+
+        replaceChild(tree, process->treeParent, process, successor);
+        successor->treeLeft = process->treeLeft;
+        successor->treeLeft->treeParent = successor;
+        successor->treeColor = process->treeColor;
+    }
+
+    if (removedColor == TREE_BLACK)
+    {
+        removeFixup(tree, child, parent);
+    }
+
+    process->treeParent = NULL;
+    process->treeLeft = NULL;
+    process->treeRight = NULL;
+    process->treeColor = NA;
+    tree->count--;
+}
+
+/**
+ * @details Returns the first process in tree order. O(1).
+ *
+ * @param[in] tree Process tree
+ *
+ * @return ProcessControlBlock Leftmost process, NULL if the tree is empty
+ */
+ProcessControlBlock *treeFirst(ProcessTree *tree)
+{
+    return tree->leftmost;
+}
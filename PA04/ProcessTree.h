@@ -0,0 +1,33 @@
+// Pre-compiler directive
+#ifndef PROCESS_TREE_H
+#define PROCESS_TREE_H
+
+#include "ProcessHeap.h"
+
+struct ProcessControlBlock;
+
+// Node colors, a PCB not in a tree has color NA
+typedef enum
+{
+    TREE_RED,
+    TREE_BLACK
+} TreeColors;
+
+// Intrusive red-black tree of PCBs ordered by compare
+// Links and color live in the PCB. The leftmost PCB is cached so the
+// next process to dispatch is found in O(1)
+typedef struct
+{
+    struct ProcessControlBlock *root;
+    struct ProcessControlBlock *leftmost;
+    int count;
+    ProcessCompare compare;
+} ProcessTree;
+
+// Function Prototypes
+void initProcessTree(ProcessTree *tree, ProcessCompare compare);
+void treeInsert(ProcessTree *tree, struct ProcessControlBlock *process);
+void treeRemove(ProcessTree *tree, struct ProcessControlBlock *process);
+struct ProcessControlBlock *treeFirst(ProcessTree *tree);
+
+#endif // PROCESS_TREE_H
@@ -0,0 +1,210 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "StringScan.h"
+
+// Page size the scans assume, strings are also timed against its end
+#define BENCH_PAGE_SIZE 4096
+
+// Calls per timed loop
+#define BENCH_ITERATIONS 2000000
+
+// A typical simulator log line, 66 characters
+static const char LOG_LINE[] =
+    "  12.345678, Process: 3, keyboard input operation start for 120 ms";
+
+// Substring searched for, near the end of the log line
+static const char SEARCH_STR[] = "120 ms";
+
+// Keeps the compiler from dropping the timed calls
+static volatile int benchSink;
+
+/**
+ * @details Length loop of getStringLength before the vector scans.
+ */
+static int oldLength(const char *testStr, int limit)
+{
+    int index = 0;
+
+    while (index < limit && testStr[index] != '\0')
+    {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @details Compare loop of compareString before the vector scans,
+ *          returning where the strings stop matching.
+ */
+static int oldMismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    int index = 0;
+
+    while (index < limit && oneStr[index] != '\0' && otherStr[index] != '\0')
+    {
+        if (oneStr[index] != otherStr[index])
+        {
+            return index;
+        }
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @details Search loop of findSubString before the vector scans, every
+ *          start position compared character by character.
+ */
+static int oldSubString(const char *testStr, int testLength,
+                        const char *searchStr, int searchLength)
+{
+    int masterIndex = 0;
+    int searchIndex;
+
+    while (masterIndex + searchLength <= testLength)
+    {
+        searchIndex = 0;
+        while (testStr[masterIndex + searchIndex] == searchStr[searchIndex])
+        {
+            searchIndex++;
+            if (searchIndex == searchLength)
+            {
+                return masterIndex;
+            }
+        }
+        masterIndex++;
+    }
+    return SCAN_NOT_FOUND;
+}
+
+/**
+ * @details Returns wall clock time in ns.
+ */
+static double nowNs(void)
+{
+    struct timeval time;
+
+    gettimeofday(&time, NULL);
+    return time.tv_sec * 1e9 + time.tv_usec * 1e3;
+}
+
+/**
+ * @brief Times the old loops against the scans on one placement.
+ *
+ * @param[in] label Placement name
+ *
+ * @param[in] oneStr Log line copy
+ *
+ * @param[in] otherStr Second copy, differing in its last character
+ */
+static void benchPlacement(const char *label, const char *oneStr, const char *otherStr)
+{
+    int length = (int)strlen(oneStr);
+    int searchLength = (int)strlen(SEARCH_STR);
+    double start;
+    double oldNs;
+    double newNs;
+    int iteration;
+
+    printf("\n%s\n", label);
+
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = oldLength(oneStr + (iteration & 1), 256);
+    }
+    oldNs = (nowNs() - start) / BENCH_ITERATIONS;
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = scanStringLength(oneStr + (iteration & 1), 256);
+    }
+    newNs = (nowNs() - start) / BENCH_ITERATIONS;
+    printf("  length     %6.1f -> %6.1f ns\n", oldNs, newNs);
+
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = oldMismatch(oneStr, otherStr, 256 - (iteration & 1));
+    }
+    oldNs = (nowNs() - start) / BENCH_ITERATIONS;
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = scanStringMismatch(oneStr, otherStr, 256 - (iteration & 1));
+    }
+    newNs = (nowNs() - start) / BENCH_ITERATIONS;
+    printf("  mismatch   %6.1f -> %6.1f ns\n", oldNs, newNs);
+
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = oldSubString(oneStr, length - (iteration & 1), SEARCH_STR, searchLength);
+    }
+    oldNs = (nowNs() - start) / BENCH_ITERATIONS;
+    start = nowNs();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++)
+    {
+        benchSink = scanSubString(oneStr, length - (iteration & 1), SEARCH_STR, searchLength);
+    }
+    newNs = (nowNs() - start) / BENCH_ITERATIONS;
+    printf("  substring  %6.1f -> %6.1f ns\n", oldNs, newNs);
+}
+
+/*
+Function name: main
+Algorithm: times the byte at a time loops the string utilities used
+           before the vector scans against scanStringLength,
+           scanStringMismatch, and scanSubString, on a log line in the
+           middle of a page and on one ending at an unreadable page
+Precondition: none
+Postcondition: ns per call of each loop are displayed, returns 0
+Exceptions: returns 1 if the guard page cannot be mapped
+Note: built with make -f Sim03_mf scanbench; the old loops are copies
+      built with the same flags as sim04, so both sides compare fairly
+*/
+int main(void)
+{
+    char middle[2][256];
+    char *region;
+    char *oneStr;
+    char *otherStr;
+    int size = (int)sizeof(LOG_LINE);
+    int fileDesc = open("/dev/zero", O_RDWR);
+
+    if (fileDesc < 0)
+    {
+        return 1;
+    }
+    region = (char *)mmap(NULL, 3 * BENCH_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE, fileDesc, 0);
+    close(fileDesc);
+    if (region == MAP_FAILED
+        || mprotect(region + 2 * BENCH_PAGE_SIZE, BENCH_PAGE_SIZE, PROT_NONE) != 0)
+    {
+        printf("ERROR: Unable to map guard page\n");
+        return 1;
+    }
+
+    memcpy(middle[0], LOG_LINE, size);
+    memcpy(middle[1], LOG_LINE, size);
+    middle[1][size - 2] = '!';
+    benchPlacement("Log line, mid page", middle[0], middle[1]);
+
+    // Each copy's terminator is the last readable byte of its page
+    oneStr = region + BENCH_PAGE_SIZE - size;
+    otherStr = region + 2 * BENCH_PAGE_SIZE - size;
+    memcpy(oneStr, LOG_LINE, size);
+    memcpy(otherStr, LOG_LINE, size);
+    otherStr[size - 2] = '!';
+    benchPlacement("Log line, ending at a page end", oneStr, otherStr);
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// The scan implementations are static, so they are built in here
+#include "StringScan.c"
+
+// Bytes mapped for each test string: one readable page, one guard page
+#define FUZZ_REGION_SIZE (2 * SCAN_PAGE_SIZE)
+
+// Longest random string, long enough to cross several vector widths
+#define FUZZ_MAX_LENGTH 200
+
+// Longest random search string
+#define FUZZ_MAX_SEARCH 8
+
+// Scan implementations under test, the scalar set first as reference
+typedef struct
+{
+    const char *name;
+    LengthScan length;
+    MismatchScan mismatch;
+    SubStringScan subString;
+} ScanSet;
+
+// Page of readable bytes followed by an unreadable one
+typedef struct
+{
+    char *region;
+    char *pageEnd;
+} GuardedPage;
+
+/**
+ * @details Maps a readable page followed by a guard page, so any read
+ *          past the readable page faults.
+ *
+ * @param[out] page Mapped page
+ *
+ * @return int 0 on success, -1 if the mapping failed
+ */
+static int mapGuardedPage(GuardedPage *page)
+{
+    int fileDesc = open("/dev/zero", O_RDWR);
+
+    if (fileDesc < 0)
+    {
+        return -1;
+    }
+    page->region = (char *)mmap(NULL, FUZZ_REGION_SIZE, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE, fileDesc, 0);
+    close(fileDesc);
+    if (page->region == MAP_FAILED
+        || mprotect(page->region + SCAN_PAGE_SIZE, SCAN_PAGE_SIZE, PROT_NONE) != 0)
+    {
+        return -1;
+    }
+    page->pageEnd = page->region + SCAN_PAGE_SIZE;
+    return 0;
+}
+
+/**
+ * @details Picks where a run of bytes starts. Half the placements end
+ *          exactly at the guard page, the rest end a few bytes before
+ *          it or sit at a random offset in the page.
+ *
+ * @param[in] page Guarded page
+ *
+ * @param[in] size Bytes to place, including any terminator
+ *
+ * @return char Start of the placement
+ */
+static char *placeBytes(GuardedPage *page, int size)
+{
+    switch (rand() % 4)
+    {
+        case 0:
+        case 1:
+            return page->pageEnd - size;
+
+        case 2:
+            return page->pageEnd - size - (rand() % 40);
+
+        default:
+            return page->region + rand() % (SCAN_PAGE_SIZE - size - 40);
+    }
+}
+
+/**
+ * @details Fills characters from a small alphabet, so mismatch and
+ *          substring searches find partial and full matches often.
+ *
+ * @param[out] dest Characters to fill
+ *
+ * @param[in] count Number of characters
+ */
+static void fillRandom(char *dest, int count)
+{
+    static const char ALPHABET[] = "aab";
+    int index;
+
+    for (index = 0; index < count; index++)
+    {
+        dest[index] = ALPHABET[rand() % 3];
+    }
+}
+
+/**
+ * @details Runs one random case of each scan through every set and counts
+ *          the sets that disagree with the scalar set.
+ *
+ * @param[in] sets Scan sets, scalar first
+ *
+ * @param[in] setCount Number of sets
+ *
+ * @param[in] pages Four guarded pages
+ *
+ * @param[in,out] failures Disagreements per set
+ */
+static void runCase(ScanSet *sets, int setCount, GuardedPage *pages, long *failures)
+{
+    int length = rand() % FUZZ_MAX_LENGTH;
+    int otherLength;
+    int searchLength = 1 + rand() % FUZZ_MAX_SEARCH;
+    int limit = (rand() % 8 == 0) ? 1 + rand() % (length + 1) : length + 1 + rand() % 40;
+    char *oneStr;
+    char *otherStr;
+    char *searchStr;
+    char *testStr;
+    int expected[3];
+    int set;
+
+    // Length, and the first string of the mismatch scan
+    oneStr = placeBytes(&pages[0], length + 1);
+    fillRandom(oneStr, length);
+    oneStr[length] = '\0';
+
+    // Mismatch partner, usually a copy with one character changed
+    otherLength = (rand() % 4 == 0) ? rand() % FUZZ_MAX_LENGTH : length;
+    otherStr = placeBytes(&pages[1], otherLength + 1);
+    fillRandom(otherStr, otherLength);
+    if (otherLength == length)
+    {
+        memcpy(otherStr, oneStr, length);
+        if (length > 0 && rand() % 2 == 0)
+        {
+            otherStr[rand() % length] = 'c';
+        }
+    }
+    otherStr[otherLength] = '\0';
+
+    // Substring search runs over characters with no terminator after them
+    testStr = placeBytes(&pages[2], length);
+    memcpy(testStr, oneStr, length);
+    searchStr = placeBytes(&pages[3], searchLength);
+    fillRandom(searchStr, searchLength);
+
+    expected[0] = sets[0].length(oneStr, limit);
+    expected[1] = sets[0].mismatch(oneStr, otherStr, limit);
+    expected[2] = sets[0].subString(testStr, length, searchStr, searchLength);
+
+    for (set = 1; set < setCount; set++)
+    {
+        if (sets[set].length(oneStr, limit) != expected[0]
+            || sets[set].mismatch(oneStr, otherStr, limit) != expected[1]
+            || sets[set].subString(testStr, length, searchStr, searchLength) != expected[2])
+        {
+            failures[set]++;
+        }
+    }
+}
+
+/*
+Function name: main
+Algorithm: runs random length, mismatch, and substring cases through
+           the scalar scans and every vector scan this processor
+           supports, with strings placed against an unreadable page
+Precondition: optional case count and random seed as arguments
+Postcondition: returns 0 if every vector scan matched the scalar scans,
+               1 otherwise
+Exceptions: a vector scan reading past a string end faults on the
+            guard page
+Note: built with make -f Sim03_mf scanfuzz
+*/
+int main(int argc, char **argv)
+{
+    long caseCount = (argc > 1) ? atol(argv[1]) : 1000000;
+    unsigned int seed = (argc > 2) ? (unsigned int)atol(argv[2]) : 1;
+    ScanSet sets[3] = { { "scalar", scalarLength, scalarMismatch, scalarSubString } };
+    long failures[3] = { 0, 0, 0 };
+    GuardedPage pages[4];
+    int setCount = 1;
+    int set;
+    long caseIndex;
+
+    for (set = 0; set < 4; set++)
+    {
+        if (mapGuardedPage(&pages[set]) != 0)
+        {
+            printf("ERROR: Unable to map guard pages\n");
+            return 1;
+        }
+    }
+
+#ifdef SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2"))
+    {
+        sets[setCount].name = "sse2";
+        sets[setCount].length = sse2Length;
+        sets[setCount].mismatch = sse2Mismatch;
+        sets[setCount].subString = sse2SubString;
+        setCount++;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        sets[setCount].name = "avx2";
+        sets[setCount].length = avx2Length;
+        sets[setCount].mismatch = avx2Mismatch;
+        sets[setCount].subString = avx2SubString;
+        setCount++;
+    }
+#endif
+
+    srand(seed);
+    for (caseIndex = 0; caseIndex < caseCount; caseIndex++)
+    {
+        runCase(sets, setCount, pages, failures);
+    }
+
+    for (set = 1; set < setCount; set++)
+    {
+        printf("%-6s : %ld of %ld cases differ from scalar\n",
+               sets[set].name, failures[set], caseCount);
+    }
+    if (setCount == 1)
+    {
+        printf("No vector scans on this processor, nothing to compare\n");
+    }
+
+    for (set = 1; set < setCount; set++)
+    {
+        if (failures[set] > 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,807 @@
+// Header files
+#include <stdlib.h>
+
+#include "SimUtils.h"
+
+// Initial number of PCBs the process table can hold before growing
+static const int INITIAL_TABLE_CAPACITY = 16;
+
+// FAIR-P weight of each priority, nice -20 to 19, nice 0 weighs 1024
+// Each step is about 1.25 times the next, so one nice level is about a
+// tenth more or less CPU against a neighbour
+static const int FAIR_WEIGHTS[FAIR_NICE_LEVELS] =
+{
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906,
+    3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423,
+    335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45,
+    36, 29, 23, 18, 15
+};
+
+/**
+ * @details Checks if the scheduling code dispatches from the ready heap.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return Boolean Returns True for SJF-N, SRTF-P, FCFS-P, STRIDE-P, and
+ *                 EDF-P
+ */
+static Boolean usesReadyHeap(SchedulerType *scheduler)
+{
+    return (scheduler->schedCode == CPU_SCHED_SJF_N_CODE) || (scheduler->schedCode == CPU_SCHED_SRTF_P_CODE) || (scheduler->schedCode == CPU_SCHED_FCFS_P_CODE) || (scheduler->schedCode == CPU_SCHED_STRIDE_P_CODE) || (scheduler->schedCode == CPU_SCHED_EDF_P_CODE);
+}
+
+/**
+ * @details Checks if the scheduling code dispatches from the ready buckets.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return Boolean Returns True for MLFQ-P, PRIORITY-N, and PRIORITY-P
+ */
+static Boolean usesReadyBuckets(SchedulerType *scheduler)
+{
+    return (scheduler->schedCode == CPU_SCHED_MLFQ_P_CODE) || (scheduler->schedCode == CPU_SCHED_PRIORITY_N_CODE) || (scheduler->schedCode == CPU_SCHED_PRIORITY_P_CODE);
+}
+
+/**
+ * @details Checks if the scheduling code dispatches from the ready tree.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return Boolean Returns True for FAIR-P
+ */
+static Boolean usesReadyTree(SchedulerType *scheduler)
+{
+    return scheduler->schedCode == CPU_SCHED_FAIR_P_CODE;
+}
+
+/**
+ * @details Checks if the scheduling code shares the CPU by tickets.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return Boolean Returns True for STRIDE-P and LOTTERY-P
+ */
+static Boolean usesTickets(SchedulerType *scheduler)
+{
+    return (scheduler->schedCode == CPU_SCHED_STRIDE_P_CODE) || (scheduler->schedCode == CPU_SCHED_LOTTERY_P_CODE);
+}
+
+/**
+ * @details Checks if a process in this state is competing for the CPU.
+ *
+ * @param[in] state ProcessStates value
+ *
+ * @return Boolean Returns True for READY and RUNNING
+ */
+static Boolean isCompeting(int state)
+{
+    return (state == READY) || (state == RUNNING);
+}
+
+/**
+ * @details Checks if the ready set only holds READY processes, so a
+ *          process leaves it when dispatched.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return Boolean Returns True for ready buckets, the ready tree, and the
+ *                 ticket codes
+ */
+static Boolean holdsOnlyReady(SchedulerType *scheduler)
+{
+    return usesReadyBuckets(scheduler) || usesReadyTree(scheduler) || usesTickets(scheduler);
+}
+
+/**
+ * @details Returns the ready bucket a process joins on entering READY:
+ *          its queue level for MLFQ-P, otherwise its own priority.
+ *
+ * @param[in] scheduler Scheduler using ready buckets
+ *
+ * @param[in] process Process entering the READY state
+ *
+ * @return int Bucket index, 0 is dispatched first
+ */
+static int readyBucket(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    if (scheduler->schedCode == CPU_SCHED_MLFQ_P_CODE)
+    {
+        return process->level;
+    }
+    return process->priority;
+}
+
+/**
+ * @brief Initializes the ready set for a scheduling code.
+ *
+ * @details SJF-N orders the ready heap by total time, SRTF-P by time
+ *          remaining, and FCFS-P by arrival (process number), since
+ *          processes re-enter READY out of arrival order after I/O.
+ *          MLFQ-P keeps one ready bucket per queue level and the
+ *          PRIORITY codes one per priority. FAIR-P orders the ready tree
+ *          by virtual run time, STRIDE-P orders the ready heap by pass, and
+ *          EDF-P by deadline.
+ *          LOTTERY-P keeps the tickets of READY processes in a ticket
+ *          tree. Other codes dispatch from the READY state queue.
+ *
+ * @param[out] scheduler Scheduler to initialize
+ *
+ * @param[in] schedCode Config data CPU scheduling code
+ */
+void initScheduler(SchedulerType *scheduler, int schedCode)
+{
+    int state;
+
+    scheduler->schedCode = schedCode;
+    scheduler->processTable = NULL;
+    scheduler->processCount = 0;
+    scheduler->processCapacity = 0;
+    scheduler->processWindow = 0;
+
+    if (schedCode == CPU_SCHED_SJF_N_CODE)
+    {
+        initProcessHeap(&scheduler->readyHeap, compareTotalTime);
+    }
+    else if (schedCode == CPU_SCHED_FCFS_P_CODE)
+    {
+        initProcessHeap(&scheduler->readyHeap, compareProcessNumber);
+    }
+    else if (schedCode == CPU_SCHED_STRIDE_P_CODE)
+    {
+        initProcessHeap(&scheduler->readyHeap, comparePass);
+    }
+    else if (schedCode == CPU_SCHED_EDF_P_CODE)
+    {
+        initProcessHeap(&scheduler->readyHeap, compareDeadline);
+    }
+    else
+    {
+        initProcessHeap(&scheduler->readyHeap, compareTimeRemaining);
+    }
+
+    initProcessBuckets(&scheduler->readyBuckets);
+    initProcessTree(&scheduler->readyTree, compareVruntime);
+    scheduler->minVruntime = 0;
+    scheduler->minPass = 0;
+    initTicketTree(&scheduler->readyTickets);
+    scheduler->competingTickets = 0;
+    scheduler->sharePerTicket = 0.0;
+    scheduler->lotteryState = LOTTERY_SEED;
+
+    for (state = NEW; state <= EXIT; state++)
+    {
+        initProcessQueue(&scheduler->stateQueues[state]);
+    }
+}
+
+/**
+ * @brief Clears scheduler.
+ *
+ * @details Releases the ready heap, the ticket tree, and the process table. The table is
+ *          one allocation, so every PCB is returned to the OS at once.
+ *
+ * @param[in] scheduler Scheduler
+ */
+void clearScheduler(SchedulerType *scheduler)
+{
+    clearProcessHeap(&scheduler->readyHeap);
+    clearTicketTree(&scheduler->readyTickets);
+    free(scheduler->processTable);
+    scheduler->processTable = NULL;
+    scheduler->processCount = 0;
+    scheduler->processCapacity = 0;
+    scheduler->processWindow = 0;
+}
+
+/**
+ * @brief Bounds the process table to a fixed number of slots.
+ *
+ * @details Allocates the whole ring up front, so PCBs never move and new
+ *          processes can be linked into queues while others run. Only
+ *          the latest window of processes can be looked up, and the
+ *          caller must not create a process while the one it replaces
+ *          has not reached EXIT.
+ *
+ * @param[in] scheduler Scheduler with no processes yet
+ *
+ * @param[in] window Number of table slots
+ */
+void setProcessWindow(SchedulerType *scheduler, int window)
+{
+    scheduler->processWindow = window;
+    scheduler->processCapacity = window;
+    scheduler->processTable = (ProcessControlBlock *)malloc(window * sizeof(ProcessControlBlock));
+}
+
+/**
+ * @brief Creates a new PCB in the process table.
+ *
+ * @details Process numbers are dense counters starting at zero, so the
+ *          new PCB is stored at index number. The table doubles when
+ *          full, which moves every PCB: returned pointers are only valid
+ *          until the next call, and processes must not be linked into
+ *          any queue until the table is complete. A windowed table never
+ *          moves; the exited process in the reused slot is unlinked from
+ *          the EXIT queue instead.
+ *
+ * @param[in] scheduler Scheduler owning the process table
+ *
+ * @param[in] number Process number, equal to the current process count
+ *
+ * @param[in] priority Process priority
+ *
+ * @param[in] programCounter Pointer to the process A(start) op code
+ *
+ * @return ProcessControlBlock New PCB in NEW state
+ */
+ProcessControlBlock *addNewPCB(SchedulerType *scheduler, int number, int priority,
+                               OpCodeType *programCounter)
+{
+    ProcessControlBlock *newProcess;
+
+    if (scheduler->processWindow > 0)
+    {
+        newProcess = &scheduler->processTable[scheduler->processCount % scheduler->processWindow];
+        if (scheduler->processCount >= scheduler->processWindow)
+        {
+            queueRemove(&scheduler->stateQueues[EXIT], newProcess);
+        }
+    }
+    else
+    {
+        if (scheduler->processCount == scheduler->processCapacity)
+        {
+            scheduler->processCapacity = (scheduler->processCapacity == 0) ? INITIAL_TABLE_CAPACITY
+                                                                           : scheduler->processCapacity * 2;
+            scheduler->processTable = (ProcessControlBlock *)realloc(scheduler->processTable,
+                                                                     scheduler->processCapacity * sizeof(ProcessControlBlock));
+        }
+        newProcess = &scheduler->processTable[scheduler->processCount];
+    }
+    scheduler->processCount++;
+
+    newProcess->number = number;
+    newProcess->priority = priority;
+    newProcess->state = NEW;
+    newProcess->programCounter = programCounter;
+    newProcess->opBlock = NULL;
+    newProcess->bursts = NULL;
+    newProcess->burstIndex = 0;
+    newProcess->burstCycles = 0;
+    newProcess->timeRemaining = 0;
+    newProcess->totalTime = 0;
+    newProcess->level = 0;
+    newProcess->vruntime = 0;
+    newProcess->pass = 0;
+    newProcess->cpuTime = 0;
+    newProcess->expectedCpuTime = 0;
+    newProcess->shareMark = 0;
+    newProcess->deadline = NA;
+    newProcess->lateness = 0;
+    newProcess->heapIndex = NA;
+    newProcess->bucket = NA;
+    newProcess->prevInBucket = NULL;
+    newProcess->nextInBucket = NULL;
+    newProcess->treeParent = NULL;
+    newProcess->treeLeft = NULL;
+    newProcess->treeRight = NULL;
+    newProcess->treeColor = NA;
+    newProcess->prevInQueue = NULL;
+    newProcess->nextInQueue = NULL;
+    return newProcess;
+}
+
+/**
+ * @details Looks up a process by number. O(1).
+ *
+ * @param[in] scheduler Scheduler owning the process table
+ *
+ * @param[in] processNum Process number
+ *
+ * @return ProcessControlBlock Matching PCB, NULL if there is none or its
+ *                             slot has been reused
+ */
+ProcessControlBlock *findPCB(SchedulerType *scheduler, int processNum)
+{
+    if (processNum < 0 || processNum >= scheduler->processCount)
+    {
+        return NULL;
+    }
+    if (scheduler->processWindow > 0)
+    {
+        if (processNum < scheduler->processCount - scheduler->processWindow)
+        {
+            return NULL;
+        }
+        return &scheduler->processTable[processNum % scheduler->processWindow];
+    }
+    return &scheduler->processTable[processNum];
+}
+
+/**
+ * @brief Links a newly created process into the NEW state queue.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process in NEW state, not linked in any queue
+ */
+void admitProcess(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    process->state = NEW;
+    queueAppend(&scheduler->stateQueues[NEW], process);
+}
+
+/**
+ * @brief Moves a process to a new state.
+ *
+ * @details Relinks the process from its current state queue to the tail
+ *          of the new one and keeps the ready heap in step: processes join
+ *          it on READY and leave it on BLOCKED or EXIT. Ready buckets, the
+ *          ready tree, and the ticket codes only hold READY processes, so
+ *          they are also left on RUNNING.
+ *          The ticket codes settle the CPU time a process was owed when
+ *          it stops competing, READY and RUNNING counting as competing.
+ *          Setting a process to the state it is already in does nothing,
+ *          so it keeps its place in line. O(1), plus O(log n) for heap
+ *          policies.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process changing state
+ *
+ * @param[in] newState ProcessStates value
+ */
+void setProcessState(SchedulerType *scheduler, ProcessControlBlock *process,
+                     int newState)
+{
+    if (process->state == newState)
+    {
+        return;
+    }
+
+    if (usesTickets(scheduler) && isCompeting(newState) != isCompeting(process->state))
+    {
+        if (isCompeting(newState))
+        {
+            process->shareMark = scheduler->sharePerTicket;
+            scheduler->competingTickets += process->priority;
+        }
+        else
+        {
+            process->expectedCpuTime += (scheduler->sharePerTicket - process->shareMark) * process->priority;
+            scheduler->competingTickets -= process->priority;
+        }
+    }
+
+    queueRemove(&scheduler->stateQueues[process->state], process);
+    queueAppend(&scheduler->stateQueues[newState], process);
+    process->state = newState;
+
+    if (newState == READY)
+    {
+        readyQueueAdd(scheduler, process);
+    }
+    else if (newState == BLOCKED || newState == EXIT || holdsOnlyReady(scheduler))
+    {
+        readyQueueRemove(scheduler, process);
+    }
+}
+
+/**
+ * @brief Sends a READY process to the back of the line for RR-P.
+ *
+ * @details Unlinks the process and relinks it at the tail of the READY
+ *          queue. O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process in READY state
+ */
+void requeueProcess(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    if (process->state == READY)
+    {
+        queueRemove(&scheduler->stateQueues[READY], process);
+        queueAppend(&scheduler->stateQueues[READY], process);
+    }
+}
+
+/**
+ * @brief Moves a process to another MLFQ level.
+ *
+ * @details A READY process is relinked at the tail of its new level's
+ *          bucket. O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process changing level
+ *
+ * @param[in] level New queue level, 0 is the top
+ */
+void setProcessLevel(SchedulerType *scheduler, ProcessControlBlock *process,
+                     int level)
+{
+    process->level = level;
+    if (process->bucket != NA && bucketIndex(&scheduler->readyBuckets, process) != level)
+    {
+        bucketRemove(&scheduler->readyBuckets, process);
+        bucketAppend(&scheduler->readyBuckets, process, level);
+    }
+}
+
+/**
+ * @brief Returns every live process to the top MLFQ level.
+ *
+ * @details READY processes are moved in the order they became READY, so
+ *          the boost does not reorder processes that were already level
+ *          with each other. O(n) over the live processes.
+ *
+ * @param[in] scheduler Scheduler
+ */
+void boostProcessLevels(SchedulerType *scheduler)
+{
+    ProcessControlBlock *process;
+    int state;
+
+    for (state = READY; state <= BLOCKED; state++)
+    {
+        for (process = stateFront(scheduler, state); process != NULL;
+             process = process->nextInQueue)
+        {
+            process->level = 0;
+            if (process->bucket != NA)
+            {
+                bucketRemove(&scheduler->readyBuckets, process);
+                bucketAppend(&scheduler->readyBuckets, process, 0);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Raises every waiting READY process one priority.
+ *
+ * @details Aging for the PRIORITY codes. The raise only lasts while the
+ *          process waits: it rejoins at its own priority the next time
+ *          it becomes READY. O(1).
+ *
+ * @param[in] scheduler Scheduler using ready buckets
+ *
+ * @return int Number of processes raised
+ */
+int ageReadyProcesses(SchedulerType *scheduler)
+{
+    return bucketShiftDown(&scheduler->readyBuckets);
+}
+
+/**
+ * @brief Charges run time to a process.
+ *
+ * @details FAIR-P virtual run time grows by the run time scaled by 1024
+ *          over the process weight, so heavier processes age slower and
+ *          get a larger share. STRIDE-P pass grows by the run time scaled
+ *          by STRIDE_SCALE over the process tickets. Either floor only
+ *          moves forward and follows the smaller of the running process
+ *          and the first READY process. The ticket codes also count the
+ *          process run time, and owe every competing process its share of
+ *          it, run time times its tickets over all competing tickets. The
+ *          share owed per ticket is summed once here, and each process
+ *          settles the difference when it stops competing, so charging
+ *          stays O(1). Other codes charge nothing. O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process RUNNING process
+ *
+ * @param[in] runTime ms the process just ran
+ */
+void chargeRuntime(SchedulerType *scheduler, ProcessControlBlock *process,
+                   double runTime)
+{
+    ProcessControlBlock *first;
+    long long floor;
+
+    if (usesReadyTree(scheduler))
+    {
+        first = treeFirst(&scheduler->readyTree);
+        floor = process->vruntime;
+
+        process->vruntime += (long long)(runTime * 1000.0 * 1024.0 / FAIR_WEIGHTS[process->priority]);
+
+        if (first != NULL && first->vruntime < floor)
+        {
+            floor = first->vruntime;
+        }
+        if (floor > scheduler->minVruntime)
+        {
+            scheduler->minVruntime = floor;
+        }
+    }
+    else if (usesTickets(scheduler))
+    {
+        process->cpuTime += runTime;
+        scheduler->sharePerTicket += runTime / scheduler->competingTickets;
+
+        if (scheduler->schedCode == CPU_SCHED_STRIDE_P_CODE)
+        {
+            first = heapPeek(&scheduler->readyHeap);
+            floor = process->pass;
+
+            process->pass += (long long)(runTime * STRIDE_SCALE / process->priority);
+
+            if (first != NULL && first->pass < floor)
+            {
+                floor = first->pass;
+            }
+            if (floor > scheduler->minPass)
+            {
+                scheduler->minPass = floor;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draws the next LOTTERY-P process.
+ *
+ * @details Each READY process holds its tickets in the ticket tree, so
+ *          one random ticket picks a process with probability equal to
+ *          its share of the READY tickets. The generator is 64-bit
+ *          xorshift, seeded with LOTTERY_SEED. Draws from the short
+ *          range of generator values that does not divide evenly
+ *          by the ticket total are thrown away, so the remainder favours
+ *          no ticket. O(log n).
+ *
+ * @param[in] scheduler Scheduler using tickets
+ *
+ * @return ProcessControlBlock Winning process, NULL if none are ready
+ */
+ProcessControlBlock *drawLottery(SchedulerType *scheduler)
+{
+    unsigned long long state = scheduler->lotteryState;
+    unsigned long long total = (unsigned long long)scheduler->readyTickets.total;
+    unsigned long long threshold;
+
+    if (total == 0)
+    {
+        return NULL;
+    }
+
+    // Rejecting the lowest 2^64 mod total draws leaves a multiple of total
+    threshold = (0 - total) % total;
+    do
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+    } while (state < threshold);
+    scheduler->lotteryState = state;
+
+    return &scheduler->processTable[ticketDraw(&scheduler->readyTickets,
+                                               (long long)(state % total))];
+}
+
+/**
+ * @details Returns the number of processes in a state. O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] state ProcessStates value
+ *
+ * @return int Number of processes in the state
+ */
+int stateCount(SchedulerType *scheduler, int state)
+{
+    return scheduler->stateQueues[state].count;
+}
+
+/**
+ * @details Returns the process that has been in a state the longest. O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] state ProcessStates value
+ *
+ * @return ProcessControlBlock Oldest process in the state, NULL if none
+ */
+ProcessControlBlock *stateFront(SchedulerType *scheduler, int state)
+{
+    return queueFront(&scheduler->stateQueues[state]);
+}
+
+/**
+ * @details Makes a process dispatchable. Processes stay in the ready heap
+ *          while RUNNING so their key can be updated each cycle, except
+ *          with STRIDE-P, whose pass is only compared between runs.
+ *          Adding a process that is already in the heap does nothing.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process entering the READY state
+ */
+void readyQueueAdd(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    if (usesReadyHeap(scheduler) && process->heapIndex == NA)
+    {
+        // A STRIDE-P process back from I/O does not bank the pass it missed
+        if ((scheduler->schedCode == CPU_SCHED_STRIDE_P_CODE) && (process->pass < scheduler->minPass))
+        {
+            process->pass = scheduler->minPass;
+        }
+        heapInsert(&scheduler->readyHeap, process);
+    }
+    else if (usesReadyBuckets(scheduler) && process->bucket == NA)
+    {
+        bucketAppend(&scheduler->readyBuckets, process, readyBucket(scheduler, process));
+    }
+    else if (scheduler->schedCode == CPU_SCHED_LOTTERY_P_CODE)
+    {
+        ticketSet(&scheduler->readyTickets, process - scheduler->processTable,
+                  process->priority);
+    }
+    else if (usesReadyTree(scheduler) && process->treeColor == NA)
+    {
+        // A process back from I/O or newly arrived starts level with the
+        // others instead of holding the CPU to catch up
+        if (process->vruntime < scheduler->minVruntime)
+        {
+            process->vruntime = scheduler->minVruntime;
+        }
+        treeInsert(&scheduler->readyTree, process);
+    }
+}
+
+/**
+ * @details Removes a process that is leaving for the BLOCKED or EXIT state,
+ *          or for RUNNING with ready buckets, the ready tree, or tickets.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process to remove
+ */
+void readyQueueRemove(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    if (usesReadyHeap(scheduler))
+    {
+        heapRemove(&scheduler->readyHeap, process);
+    }
+    else if (usesReadyBuckets(scheduler))
+    {
+        bucketRemove(&scheduler->readyBuckets, process);
+    }
+    else if (usesReadyTree(scheduler))
+    {
+        treeRemove(&scheduler->readyTree, process);
+    }
+    else if (scheduler->schedCode == CPU_SCHED_LOTTERY_P_CODE)
+    {
+        ticketSet(&scheduler->readyTickets, process - scheduler->processTable, 0);
+    }
+}
+
+/**
+ * @details Restores order after the process time remaining was lowered.
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @param[in] process Process whose key decreased
+ */
+void readyQueueUpdate(SchedulerType *scheduler, ProcessControlBlock *process)
+{
+    if (usesReadyHeap(scheduler))
+    {
+        heapDecreaseKey(&scheduler->readyHeap, process);
+    }
+}
+
+/**
+ * @details Returns the next process to dispatch: the top of the ready heap
+ *          for heap policies, the oldest process in the highest non-empty
+ *          bucket for MLFQ-P and the PRIORITY codes, the least virtual run
+ *          time for FAIR-P, otherwise the longest waiting READY process.
+ *          LOTTERY-P dispatches by drawLottery instead.
+ *          O(1).
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return ProcessControlBlock Next process, NULL if none are ready
+ */
+ProcessControlBlock *readyQueuePeek(SchedulerType *scheduler)
+{
+    if (usesReadyHeap(scheduler))
+    {
+        return heapPeek(&scheduler->readyHeap);
+    }
+    if (usesReadyBuckets(scheduler))
+    {
+        return bucketPeek(&scheduler->readyBuckets);
+    }
+    if (usesReadyTree(scheduler))
+    {
+        return treeFirst(&scheduler->readyTree);
+    }
+    return stateFront(scheduler, READY);
+}
+
+/**
+ * @details SJF-N ordering. Ties are broken by process number, which keeps
+ *          the FCFS-N order of the PCB list.
+ */
+int compareTotalTime(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    if (first->totalTime != second->totalTime)
+    {
+        return (first->totalTime < second->totalTime) ? -1 : 1;
+    }
+    return first->number - second->number;
+}
+
+/**
+ * @details SRTF-P ordering. Ties are broken by process number, which keeps
+ *          the FCFS-N order of the PCB list.
+ */
+int compareTimeRemaining(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    if (first->timeRemaining != second->timeRemaining)
+    {
+        return (first->timeRemaining < second->timeRemaining) ? -1 : 1;
+    }
+    return first->number - second->number;
+}
+
+/**
+ * @details FCFS-P ordering. Processes arrive at the start of the
+ *          simulation or, when streamed, in metadata order, so arrival
+ *          order is process number order.
+ */
+int compareProcessNumber(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    return first->number - second->number;
+}
+
+/**
+ * @details FAIR-P ordering. Ties are broken by process number, so equal
+ *          shares are handed out in arrival order.
+ */
+int compareVruntime(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    if (first->vruntime != second->vruntime)
+    {
+        return (first->vruntime < second->vruntime) ? -1 : 1;
+    }
+    return first->number - second->number;
+}
+
+/**
+ * @details STRIDE-P ordering. Ties are broken by process number, so
+ *          equal passes are handed out in arrival order.
+ */
+int comparePass(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    if (first->pass != second->pass)
+    {
+        return (first->pass < second->pass) ? -1 : 1;
+    }
+    return first->number - second->number;
+}
+
+/**
+ * @details EDF-P ordering. Processes without an admitted deadline come
+ *          after every deadline, and ties are broken by process number.
+ */
+int compareDeadline(ProcessControlBlock *first, ProcessControlBlock *second)
+{
+    if (first->deadline != second->deadline)
+    {
+        if (first->deadline == NA || second->deadline == NA)
+        {
+            return (first->deadline == NA) ? 1 : -1;
+        }
+        return (first->deadline < second->deadline) ? -1 : 1;
+    }
+    return first->number - second->number;
+}
@@ -0,0 +1,93 @@
+// Pre-compiler directive
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "ProcessBuckets.h"
+#include "ProcessHeap.h"
+#include "ProcessQueue.h"
+#include "ProcessTree.h"
+#include "TicketTree.h"
+
+struct OpCodeType;
+
+// Number of FAIR-P weights, one per nice value from -20 to 19
+#define FAIR_NICE_LEVELS 40
+
+// STRIDE-P pass of one ms run on a single ticket, also the ticket limit
+#define STRIDE_SCALE (1 << 20)
+
+// LOTTERY-P draws are seeded the same every run, so runs repeat
+#define LOTTERY_SEED 2463534242u
+
+// Process States
+typedef enum
+{
+    NEW,
+    READY,
+    RUNNING,
+    BLOCKED,
+    EXIT
+} ProcessStates;
+
+// Process table and ready set used by the configured scheduling code
+// PCBs are stored contiguously, indexed by process number,
+// and every PCB is linked into exactly one state queue
+// With a process window, the table is a ring of that many slots and a
+// new process takes the slot of the one created a window earlier
+typedef struct
+{
+    int schedCode;
+    struct ProcessControlBlock *processTable;
+    int processCount;
+    int processCapacity;
+    int processWindow;
+    ProcessHeap readyHeap;
+    ProcessBuckets readyBuckets;
+    ProcessTree readyTree;
+    long long minVruntime;
+    long long minPass;
+    TicketTree readyTickets;
+    long long competingTickets;
+    double sharePerTicket;
+    unsigned long long lotteryState;
+    ProcessQueue stateQueues[EXIT + 1];
+} SchedulerType;
+
+// Function Prototypes
+void initScheduler(SchedulerType *scheduler, int schedCode);
+void clearScheduler(SchedulerType *scheduler);
+void setProcessWindow(SchedulerType *scheduler, int window);
+struct ProcessControlBlock *addNewPCB(SchedulerType *scheduler, int number, int priority,
+                                     struct OpCodeType *programCounter);
+struct ProcessControlBlock *findPCB(SchedulerType *scheduler, int processNum);
+void admitProcess(SchedulerType *scheduler, struct ProcessControlBlock *process);
+void setProcessState(SchedulerType *scheduler, struct ProcessControlBlock *process,
+                     int newState);
+void requeueProcess(SchedulerType *scheduler, struct ProcessControlBlock *process);
+void setProcessLevel(SchedulerType *scheduler, struct ProcessControlBlock *process,
+                     int level);
+void boostProcessLevels(SchedulerType *scheduler);
+int ageReadyProcesses(SchedulerType *scheduler);
+void chargeRuntime(SchedulerType *scheduler, struct ProcessControlBlock *process,
+                   double runTime);
+struct ProcessControlBlock *drawLottery(SchedulerType *scheduler);
+int stateCount(SchedulerType *scheduler, int state);
+struct ProcessControlBlock *stateFront(SchedulerType *scheduler, int state);
+void readyQueueAdd(SchedulerType *scheduler, struct ProcessControlBlock *process);
+void readyQueueRemove(SchedulerType *scheduler, struct ProcessControlBlock *process);
+void readyQueueUpdate(SchedulerType *scheduler, struct ProcessControlBlock *process);
+struct ProcessControlBlock *readyQueuePeek(SchedulerType *scheduler);
+int compareTotalTime(struct ProcessControlBlock *first,
+                     struct ProcessControlBlock *second);
+int compareTimeRemaining(struct ProcessControlBlock *first,
+                         struct ProcessControlBlock *second);
+int compareProcessNumber(struct ProcessControlBlock *first,
+                         struct ProcessControlBlock *second);
+int compareVruntime(struct ProcessControlBlock *first,
+                    struct ProcessControlBlock *second);
+int comparePass(struct ProcessControlBlock *first,
+                struct ProcessControlBlock *second);
+int compareDeadline(struct ProcessControlBlock *first,
+                    struct ProcessControlBlock *second);
+
+#endif // SCHEDULER_H
@@ -2,6 +2,8 @@
 #include <stdio.h>
 #include "ConfigAccess.h"
 #include "MetaDataAccess.h"
+#include "MetaDataImage.h"
+#include "ProcessStream.h"
 #include "simtimer.h"
 #include "SimUtils.h"
 
@@ -16,23 +18,45 @@ Precondition: none
 Postcondition: returns 0 on success
 Exceptions: none
 Note: demonstrate development and use of config file upload
-      operations and function.
+      operations and function. Usage is sim04 [-s] <config file>;
+      with -s, FCFS-N and FCFS-P start running processes while the
+      rest of a text metadata file is still being parsed.
 */
 int main(int argc, char **argv)
 {
     int configAccessResult;
     int mdAccessResult;
+    int argIndex;
     char configFileName[MAX_STR_LEN];
     char mdFileName[MAX_STR_LEN];
     ConfigDataType *configDataPtr;
-    OpCodeType *mdDataPtr;
+    OpCodeType *mdDataPtr = NULL;
+    MetaDataImage mdImage;
+    MetaDataImage *mdImagePtr = NULL;
+    ProcessStream mdStream;
+    ProcessStream *mdStreamPtr = NULL;
+    Boolean streamMetaData = False;
 
     printf("\nSimulator Program\n");
     printf("===================\n\n");
 
     printf("Uploading Configuration Files\n");
 
-    if (argc < 2)
+    // The config file is the one argument that is not a flag
+    configFileName[0] = NULL_CHAR;
+    for (argIndex = 1; argIndex < argc; argIndex++)
+    {
+        if (compareString(argv[argIndex], "-s") == STR_EQ)
+        {
+            streamMetaData = True;
+        }
+        else
+        {
+            copyString(configFileName, argv[argIndex]);
+        }
+    }
+
+    if (getStringLength(configFileName) == 0)
     {
         printf("ERROR: Program requires file name for config file");
         printf(" as command line argument\n");
@@ -40,7 +64,6 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    copyString(configFileName, argv[1]);
     configAccessResult = getConfigData(configFileName, &configDataPtr);
 
     if (configAccessResult != NO_ERR)
@@ -54,20 +77,66 @@ int main(int argc, char **argv)
     printf("\nUploading Metadata Files\n");
 
     copyString(mdFileName, configDataPtr->metaDataFileName);
-    mdAccessResult = getOpCodes(mdFileName, &mdDataPtr);
+
+    // Precompiled images are mapped in place instead of parsed
+    if (isMetaDataImage(mdFileName))
+    {
+        mdAccessResult = loadMetaDataImage(mdFileName, &mdImage);
+        mdDataPtr = mdImage.ops;
+        mdImagePtr = &mdImage;
+    }
+    // FCFS processes run in metadata order, so they can be dispatched
+    // as they are parsed
+    else if (streamMetaData
+             && ((configDataPtr->cpuSchedCode == CPU_SCHED_FCFS_N_CODE)
+                 || (configDataPtr->cpuSchedCode == CPU_SCHED_FCFS_P_CODE)))
+    {
+        mdAccessResult = openProcessStream(&mdStream, mdFileName);
+        if (mdAccessResult == NO_ERR)
+        {
+            mdStreamPtr = &mdStream;
+        }
+    }
+    else
+    {
+        mdAccessResult = getOpCodes(mdFileName, &mdDataPtr);
+    }
 
     if (mdAccessResult != NO_ERR)
     {
         displayMetaDataError(mdAccessResult);
         clearConfigData(&configDataPtr);
-        mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+        if (mdImagePtr != NULL)
+        {
+            closeMetaDataImage(mdImagePtr);
+        }
+        else
+        {
+            mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+        }
         printf("\n");
         return 0;
     }
     printf("\n");
-    runSim(mdDataPtr, configDataPtr);
+    runSim(mdDataPtr, mdImagePtr, mdStreamPtr, configDataPtr);
     clearConfigData(&configDataPtr);
-    mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+    if (mdImagePtr != NULL)
+    {
+        closeMetaDataImage(mdImagePtr);
+    }
+    else if (mdStreamPtr != NULL)
+    {
+        // Errors after the first process end the stream instead
+        mdAccessResult = closeProcessStream(mdStreamPtr);
+        if (mdAccessResult != NO_ERR)
+        {
+            displayMetaDataError(mdAccessResult);
+        }
+    }
+    else
+    {
+        mdDataPtr = clearMetaDataList(mdDataPtr); // returns null
+    }
     printf("\n");
     return 0;
-}
\ No newline at end of file
+}
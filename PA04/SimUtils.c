@@ -4,363 +4,645 @@
 
 #include "SimUtils.h"
 
-// Value used in placeholder node
+// Value used for unused arguments and empty indices
 const int NA = -1;
 
+// Per-simulation arena for memory and interrupt nodes, released in one
+// call when runSim ends
+static Arena simArena = ARENA_INITIALIZER;
+
 /**
  * @brief Main simulator runner.
  *
  * @details Creates processes, executes op codes in the processes,
- *          stores output in LogOutput linked list, and outputs to monitor,
+ *          streams output to the log file as it runs, and outputs to monitor,
  *          file, or both. Supports FCFS-N, array arranged for this by default,
  *          and SJF-N.
  *
  * @param[in] opCodes Head pointer to metadata op codes.
  *                    Should be pointing at S(start)0
  *
+ * @param[in] image Precompiled image the op codes are mapped from,
+ *                  NULL for parsed metadata
+ *
+ * @param[in] stream Metadata stream processes are admitted from as they
+ *                   are parsed, NULL when opCodes holds every process
+ *
  * @param[in] configData Pointer to config data struct.
  */
-void runSim(OpCodeType *opCodes, ConfigDataType *configData)
+void runSim(OpCodeType *opCodes, MetaDataImage *image, ProcessStream *stream,
+            ConfigDataType *configData)
 {
-    LogOutput *outputHeadPtr = NULL;
-    // Because we must initialize the pointer in the main function,
-    // we create a placeholder node with value NA for everything.
-    // This node will be overrided with a real memory node.
-    MemoryNode *memoryHeadPtr = addNewMemoryNode(NULL, NA, NA, NA, NA);
+    LogOutput outputLog;
+    LogOutput *outputPtr = &outputLog;
+    MemoryList memory;
+    initMemoryList(&memory, &simArena);
+    BurstTable burstTable = {NULL, 0, 0};
 
-    ProcessControlBlock *headPCBNode = addNewPCB(NULL, NA, NA, NULL);
+    SchedulerType scheduler;
+    initScheduler(&scheduler, configData->cpuSchedCode);
+    IOPool ioPool;
 
     char tempStr[MAX_STR_LEN];
     char timeStr[MAX_STR_LEN];
 
+    if (configData->clockCode == CLOCK_VIRTUAL_CODE)
+    {
+        setTimerMode(VIRTUAL_TIMER_MODE);
+    }
+    else
+    {
+        setTimerMode(REAL_TIMER_MODE);
+
+        // Non-preemptive schedulers wait on their I/O instead of taking interrupts
+        if ((configData->cpuSchedCode == CPU_SCHED_SJF_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_PRIORITY_N_CODE))
+        {
+            startIOPool(&ioPool, NULL);
+        }
+        else
+        {
+            startIOPool(&ioPool, postIOInterrupt);
+        }
+    }
+
     if (configData->logToCode != LOGTO_MONITOR_CODE)
     {
-        outputHeadPtr = createLogFileHeader(configData, outputHeadPtr);
+        openLogOutput(outputPtr, configData->logToFileName);
+        createLogFileHeader(configData, outputPtr);
+    }
+    else
+    {
+        openLogOutput(outputPtr, NULL);
     }
 
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr,
-                               "=================\n");
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr,
-                               "Begin Simulation\n\n");
+    outputLine(configData->logToCode, outputPtr,
+               "=================\n");
+    outputLine(configData->logToCode, outputPtr,
+               "Begin Simulation\n\n");
     accessTimer(ZERO_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: System Start\n", timeStr);
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
+    outputLine(configData->logToCode, outputPtr, tempStr);
 
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: Create Process Control Blocks\n", timeStr);
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
-    createProcesses(opCodes, configData, headPCBNode);
+    outputLine(configData->logToCode, outputPtr, tempStr);
+    if (stream != NULL)
+    {
+        setProcessWindow(&scheduler, STREAM_PROCESS_WINDOW);
+        admitStreamedProcesses(stream, configData, &scheduler);
+    }
+    else
+    {
+        createProcesses(opCodes, image, configData, &burstTable, &scheduler);
+    }
 
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: All Processes initialized in NEW state\n", timeStr);
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
+    outputLine(configData->logToCode, outputPtr, tempStr);
+
+    if (configData->cpuSchedCode == CPU_SCHED_EDF_P_CODE)
+    {
+        reportAdmission(configData, outputPtr, &scheduler);
+    }
+
+    // Move every process to READY, keeping creation order
+    while (stateCount(&scheduler, NEW) > 0)
+    {
+        setProcessState(&scheduler, stateFront(&scheduler, NEW), READY);
+    }
 
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: All Processes now set in READY state\n", timeStr);
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
+    outputLine(configData->logToCode, outputPtr, tempStr);
 
     ProcessControlBlock *currentProcess;
-    while (allProcessesEnded(headPCBNode) != True || waitingQueue(CHECK_QUEUE, NA) == False)
+    double idleStart;
+    double idleTime = 0.0;
+    double nextBoost = configData->mlfqBoostTime / 1000.0;
+    double nextAging = configData->priorityAgingTime / 1000.0;
+    int agedCount;
+    while (allProcessesEnded(&scheduler) != True || stateCount(&scheduler, BLOCKED) > 0)
     {
-        // No processes ready, but there are processes in the waiting queue
-        if (allProcessesEnded(headPCBNode) && waitingQueue(CHECK_QUEUE, NA) == False)
+        // MLFQ-P periodically returns every process to the top level
+        if ((configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE) && (configData->mlfqBoostTime > 0)
+            && (accessTimer(LAP_TIMER, timeStr) >= nextBoost))
         {
-            // accessTimer(LAP_TIMER, timeStr);
-            // sprintf(tempStr, "  %s, OS: System/CPU idle\n", timeStr);
-            // outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
+            boostProcessLevels(&scheduler);
+            sprintf(tempStr, "  %s, OS: All processes boosted to level 0\n", timeStr);
+            outputLine(configData->logToCode, outputPtr, tempStr);
+            while (nextBoost <= accessTimer(LAP_TIMER, timeStr))
+            {
+                nextBoost += configData->mlfqBoostTime / 1000.0;
+            }
+        }
 
-            // Loop while there are no interrutps
-            while (interruptManager(CHECK_FOR_INTERRUPTS, NA, NA, NULL, NULL, NULL, headPCBNode, NA) == NULL)
+        // PRIORITY codes raise processes that keep waiting in READY
+        if (((configData->cpuSchedCode == CPU_SCHED_PRIORITY_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_PRIORITY_P_CODE))
+            && (configData->priorityAgingTime > 0) && (accessTimer(LAP_TIMER, timeStr) >= nextAging))
+        {
+            // One raise per aging period that has passed
+            while (nextAging <= accessTimer(LAP_TIMER, timeStr))
             {
+                agedCount = ageReadyProcesses(&scheduler);
+                if (agedCount > 0)
+                {
+                    sprintf(tempStr, "  %s, OS: %d READY processes aged one priority\n",
+                            timeStr, agedCount);
+                    outputLine(configData->logToCode, outputPtr, tempStr);
+                }
+                nextAging += configData->priorityAgingTime / 1000.0;
             }
-            headPCBNode = interruptManager(RESOLVE_INTERRUPTS, NA, NA, NULL, outputHeadPtr, configData, headPCBNode, NA);
+        }
+
+        // No processes ready, but there are processes in the waiting queue
+        if (allProcessesEnded(&scheduler))
+        {
+            // Sleep until an I/O completion arrives, counting the time as CPU idle
+            idleStart = accessTimer(LAP_TIMER, timeStr);
+            interruptManager(WAIT_FOR_INTERRUPTS, NA, NA, NULL, NULL, configData, NA, NULL);
+            idleTime += accessTimer(LAP_TIMER, timeStr) - idleStart;
+
+            interruptManager(RESOLVE_INTERRUPTS, NA, NA, NULL, outputPtr, configData, NA, &scheduler);
         }
         else
         {
-            currentProcess = selectNextProcess(headPCBNode, configData->cpuSchedCode);
-            // If new, set to ready
-            currentProcess->state = READY;
-            headPCBNode = runProcess(currentProcess, configData, outputHeadPtr, memoryHeadPtr, headPCBNode);
+            currentProcess = selectNextProcess(&scheduler);
+            runProcess(currentProcess, configData, outputPtr, &memory, &scheduler, &ioPool);
+        }
+
+        // Streamed processes take the places of those that exited
+        if (stream != NULL)
+        {
+            admitStreamedProcesses(stream, configData, &scheduler);
+            while (stateCount(&scheduler, NEW) > 0)
+            {
+                setProcessState(&scheduler, stateFront(&scheduler, NEW), READY);
+            }
         }
     }
 
+    accessTimer(LAP_TIMER, timeStr);
+    sprintf(tempStr, "  %s, OS: System/CPU idle for %.6f sec total\n", timeStr, idleTime);
+    outputLine(configData->logToCode, outputPtr, tempStr);
+
+    if ((configData->cpuSchedCode == CPU_SCHED_STRIDE_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_LOTTERY_P_CODE))
+    {
+        reportCpuShares(configData, outputPtr, &scheduler);
+    }
+    else if (configData->cpuSchedCode == CPU_SCHED_EDF_P_CODE)
+    {
+        reportDeadlines(configData, outputPtr, &scheduler);
+    }
+
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: System Stop\n", timeStr);
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr, tempStr);
+    outputLine(configData->logToCode, outputPtr, tempStr);
 
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr,
-                               "End Simulation - Complete\n");
-    outputHeadPtr = outputLine(configData->logToCode, outputHeadPtr,
-                               "=========================\n");
+    outputLine(configData->logToCode, outputPtr,
+               "End Simulation - Complete\n");
+    outputLine(configData->logToCode, outputPtr,
+               "=========================\n");
 
-    if (configData->logToCode != LOGTO_MONITOR_CODE)
+    if (configData->clockCode != CLOCK_VIRTUAL_CODE)
+    {
+        stopIOPool(&ioPool);
+    }
+    interruptManager(CLEAR_INTERRUPTS, NA, NA, NULL, NULL, NULL, NA, NULL);
+    if (stream != NULL)
     {
-        outputToFile(outputHeadPtr, configData->logToFileName);
+        releaseStreamedProcesses(&scheduler);
     }
-    headPCBNode = clearPCBList(headPCBNode);
-    outputHeadPtr = clearLogOutput(outputHeadPtr);
-    memoryHeadPtr = clearMemoryList(memoryHeadPtr);
+    clearScheduler(&scheduler);
+    clearBurstTable(&burstTable);
+    closeLogOutput(outputPtr);
+    clearMemoryList(&memory);
+    clearArena(&simArena);
 }
 
-Boolean allProcessesEnded(ProcessControlBlock *headPtr)
+// No process is ready to run; BLOCKED processes may still be waiting on I/O
+Boolean allProcessesEnded(SchedulerType *scheduler)
 {
-    while (headPtr != NULL)
-    {
-        if ((headPtr->state == READY) || (headPtr->state == NEW))
-        {
-            return False;
-        }
-        headPtr = headPtr->next;
-    }
-    return True;
+    return (stateCount(scheduler, READY) == 0);
 }
 
-ProcessControlBlock *selectNextProcess(ProcessControlBlock *headPtr, int schedCode)
+ProcessControlBlock *selectNextProcess(SchedulerType *scheduler)
 {
-    if (schedCode == CPU_SCHED_SJF_N_CODE || schedCode == CPU_SCHED_SRTF_P_CODE)
+    if (scheduler->schedCode == CPU_SCHED_LOTTERY_P_CODE)
     {
-        return findMinimum(headPtr, schedCode);
+        return drawLottery(scheduler);
     }
-    return findNextReady(headPtr, schedCode);
+    return readyQueuePeek(scheduler);
+}
+
+// I/O pool completion handler used by the preemptive schedulers
+void postIOInterrupt(SimEvent *request)
+{
+    interruptManager(ADD_NODE, NA, request->processNum, request->outputStr,
+                     NULL, NULL, request->cycleTime, NULL);
 }
 
 /**
- * @brief Thread runner for run and I/O op code execution.
+ * @brief Priority a new process is created with.
  *
- * @details Thread runner that calculates the cycle time of the op code
- *          and executes the op code. Stores calculated
- *          cycle time in inputStruct.
+ * @details FCFS codes use arrival order. The PRIORITY codes read the
+ *          value of the process's A(start), 0 being the highest; values
+ *          past the last ready bucket share it. FAIR-P reads it as a nice
+ *          value offset by 20, so 20 is nice 0 and 0 to 39 covers nice
+ *          -20 to 19; larger values share 39. STRIDE-P and LOTTERY-P read
+ *          it as the process's tickets, at least one and at most
+ *          STRIDE_SCALE. EDF-P reads it as the process's relative deadline
+ *          in ms, 0 for none.
+ *
+ * @param[in] configData Pointer to config data struct
  *
- * @param[in] inputStruct Contains a pointer to the configData,
- *                        the log to Code, the op code to be executed,
- *                        the process number of the current process
- *                        in RUNNING state, and the LogOutput linked list.
+ * @param[in] number Process number
+ *
+ * @param[in] processStart The process's A(start)
+ *
+ * @return int Process priority
  */
-void *timerRunner(void *inputStruct)
+int initialPriority(ConfigDataType *configData, int number, OpCodeType *processStart)
 {
-    TimerRunnerStruct *structPtr = (TimerRunnerStruct *)inputStruct;
-
-    char *outputStr = structPtr->opCode->opName;
-    switch (structPtr->opCode->opLtr)
+    if ((configData->cpuSchedCode == CPU_SCHED_FCFS_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE))
     {
-    case 'I':
-        concatenateString(outputStr, " input");
-        break;
-    case 'O':
-        concatenateString(outputStr, " output");
-        break;
+        return number;
     }
-    double cycleTime = structPtr->configData->ioCycleRate * structPtr->opCode->opValue;
-
-    runTimer(cycleTime);
-    structPtr->cycleTime = cycleTime;
-
-    pthread_exit(NULL);
-}
-
-void *timerRunnerPremptive(void *inputStruct)
-{
-    TimerRunnerStruct *structPtr = (TimerRunnerStruct *)inputStruct;
-    int processNum = structPtr->processNum;
-    pthread_mutex_t *mutexLock = structPtr->mutexLock;
-
-    runTimer(structPtr->cycleTime);
-
-    // critical section
-    pthread_mutex_lock(mutexLock);
-
-    // Add interrupt node
-    interruptManager(ADD_NODE, NA, processNum, structPtr->outputStr, NULL, NULL, NULL, structPtr->cycleTime);
-
-    pthread_mutex_unlock(mutexLock);
-
-    pthread_exit(NULL);
+    if ((configData->cpuSchedCode == CPU_SCHED_PRIORITY_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_PRIORITY_P_CODE))
+    {
+        if (processStart->opValue >= PROCESS_BUCKET_COUNT)
+        {
+            return PROCESS_BUCKET_COUNT - 1;
+        }
+        return processStart->opValue;
+    }
+    if (configData->cpuSchedCode == CPU_SCHED_FAIR_P_CODE)
+    {
+        if (processStart->opValue >= FAIR_NICE_LEVELS)
+        {
+            return FAIR_NICE_LEVELS - 1;
+        }
+        return processStart->opValue;
+    }
+    if ((configData->cpuSchedCode == CPU_SCHED_STRIDE_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_LOTTERY_P_CODE))
+    {
+        if (processStart->opValue < 1)
+        {
+            return 1;
+        }
+        if (processStart->opValue > STRIDE_SCALE)
+        {
+            return STRIDE_SCALE;
+        }
+        return processStart->opValue;
+    }
+    if (configData->cpuSchedCode == CPU_SCHED_EDF_P_CODE)
+    {
+        return (processStart->opValue > 0) ? processStart->opValue : 0;
+    }
+    return 0;
 }
 
 /**
  * @brief Creates PCB objects and stores them in an array.
  *
- * @details Loops through all op codes, creates a ProcessControlBlock
+ * @details Loops through all op codes once, creates a ProcessControlBlock
  *          for each A(start) with a pointer to the A(start) op code,
- *          stores each PCB in an array, and calculates the total cycle time
- *          remaining for each process.
+ *          stores each PCB in the scheduler process table, and calculates
+ *          the total cycle time remaining for each process. Every timed op
+ *          code is added to the burst table on the same pass, and each
+ *          process is pointed at its first burst once the table stops
+ *          growing. Processes are admitted to the NEW state once the
+ *          process table stops growing, after the EDF-P admission test.
+ *          A precompiled image's process index supplies the A(start)
+ *          positions and cycle sums instead.
  *
  * @param[in] opCodes Head pointer to the op codes linked list.
  *                    Starts at S(start)
  *
+ * @param[in] image Precompiled image the op codes are mapped from,
+ *                  NULL for parsed metadata
+ *
  * @param[in] configData Pointer to config data struct
  *
- * @param[out] processArray[] ProcessControlBlock array that stores each process
+ * @param[out] burstTable Empty burst table, filled for every process
+ *
+ * @param[out] scheduler Scheduler whose process table stores each process
  *
  * @return none
  */
-void createProcesses(OpCodeType *opCodes, ConfigDataType *configData,
-                     ProcessControlBlock *headPtr)
+void createProcesses(OpCodeType *opCodes, MetaDataImage *image,
+                     ConfigDataType *configData, BurstTable *burstTable,
+                     SchedulerType *scheduler)
 {
     int counter = 0;
+    int index;
     ProcessControlBlock *newProcess = NULL;
 
-    while (opCodes != NULL)
+    if (image != NULL)
     {
-        // Skip S(start)
-        if ((opCodes->opLtr == 'S') && (compareString(opCodes->opName, "start") == STR_EQ))
-        {
-            opCodes = opCodes->next;
-        }
-        else if ((opCodes->opLtr == 'A') && (compareString(opCodes->opName, "start") == STR_EQ))
+        createIndexedProcesses(image, configData, burstTable, scheduler);
+    }
+    else
+    {
+        // Op codes are stored back to back up to S(end)
+        while (!((opCodes->opLtr == 'S') && (opCodes->opName == OP_END_CODE)))
         {
-            // Create PCB and store in linked list
-            if ((configData->cpuSchedCode == CPU_SCHED_FCFS_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE))
+            // Skip S(start)
+            if ((opCodes->opLtr == 'S') && (opCodes->opName == OP_START_CODE))
             {
-                headPtr = addNewPCB(headPtr, counter, counter, opCodes);
-                opCodes = opCodes->next;
-                newProcess = getLastNode(headPtr);
+                opCodes++;
+            }
+            else if ((opCodes->opLtr == 'A') && (opCodes->opName == OP_START_CODE))
+            {
+                // Create PCB and store in linked list
+                newProcess = addNewPCB(scheduler, counter,
+                                       initialPriority(configData, counter, opCodes), opCodes);
+                opCodes++;
                 counter++;
+                // Table may still move; hold the first burst's index for now
+                newProcess->burstIndex = burstTable->count;
+            }
+            // Do not add memory op code values to time remaining
+            else if (opCodes->opLtr == 'M')
+            {
+                opCodes++;
             }
             else
             {
-                headPtr = addNewPCB(headPtr, counter, 0, opCodes);
-                opCodes = opCodes->next;
-                newProcess = getLastNode(headPtr);
-                counter++;
+                // Add op code cycle time
+                newProcess->totalTime += addBurst(burstTable, opCodes, configData);
+                opCodes++;
             }
         }
-        // Do not add memory op code values to time remaining
-        else if (opCodes->opLtr == 'M')
-        {
-            opCodes = opCodes->next;
-        }
-        else
+        // S(end) closes the table, so every process has a burst to point at
+        addBurst(burstTable, opCodes, configData);
+
+        for (index = 0; index < scheduler->processCount; index++)
         {
-            // Add op code cycle time
-            newProcess->timeRemaining += calcCycleTime(opCodes, configData);
-            newProcess->totalTime += calcCycleTime(opCodes, configData);
-            opCodes = opCodes->next;
+            newProcess = &scheduler->processTable[index];
+            newProcess->bursts = &burstTable->bursts[newProcess->burstIndex];
+            newProcess->burstIndex = 0;
+            newProcess->timeRemaining = newProcess->totalTime;
         }
     }
+
+    if (configData->cpuSchedCode == CPU_SCHED_EDF_P_CODE)
+    {
+        admitDeadlines(scheduler);
+    }
+
+    for (index = 0; index < scheduler->processCount; index++)
+    {
+        admitProcess(scheduler, &scheduler->processTable[index]);
+    }
 }
 
-ProcessControlBlock *getLastNode(ProcessControlBlock *head)
+/**
+ * @brief EDF-P admission test.
+ *
+ * @details Every process arrives at the start of the simulation, so its
+ *          deadline is its relative deadline. Processes are taken in
+ *          arrival order and each one asking for a deadline is admitted
+ *          while the summed utilization, total time over relative
+ *          deadline, stays at or below 1, the EDF bound. Total time
+ *          includes I/O, since a process cannot finish sooner, which
+ *          makes the test conservative. A process that does not fit
+ *          keeps no deadline and runs after every admitted one. O(n).
+ *
+ * @param[in] scheduler Scheduler with a complete process table
+ */
+void admitDeadlines(SchedulerType *scheduler)
 {
-    while (head != NULL)
+    ProcessControlBlock *process;
+    double utilization = 0.0;
+    double share;
+    int index;
+
+    for (index = 0; index < scheduler->processCount; index++)
     {
-        if (head->next == NULL)
+        process = &scheduler->processTable[index];
+        if (process->priority > 0)
         {
-            return head;
+            share = process->totalTime / process->priority;
+            if (utilization + share <= 1.0)
+            {
+                utilization += share;
+                process->deadline = process->priority;
+            }
         }
-        head = head->next;
     }
-    return NULL;
 }
 
-ProcessControlBlock *addNewPCB(ProcessControlBlock *head, int number, int priority,
-                               OpCodeType *programCounter)
+/**
+ * @brief Logs the outcome of the EDF-P admission test.
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] scheduler Scheduler after admitDeadlines
+ */
+void reportAdmission(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler)
 {
-    if (head == NULL)
-    {
-        head = (ProcessControlBlock *)malloc(sizeof(ProcessControlBlock));
-        head->number = number;
-        head->priority = priority;
-        head->state = NEW;
-        head->programCounter = programCounter;
-        head->timeRemaining = 0;
-        head->totalTime = 0;
-        head->next = NULL;
-        return head;
-    }
-    // First node will be a placeholder, so overwrite its values
-    // with a real memory node
-    else if (head->number == NA)
+    char tempStr[MAX_STR_LEN];
+    char timeStr[MAX_STR_LEN];
+    ProcessControlBlock *process;
+    double utilization = 0.0;
+    int index;
+
+    accessTimer(LAP_TIMER, timeStr);
+    for (index = 0; index < scheduler->processCount; index++)
     {
-        (*head).number = number;
-        (*head).priority = priority;
-        (*head).state = NEW;
-        (*head).programCounter = programCounter;
-        (*head).timeRemaining = 0;
-        (*head).totalTime = 0;
-        (*head).next = NULL;
-        return head;
+        process = &scheduler->processTable[index];
+        if (process->deadline != NA)
+        {
+            utilization += process->totalTime / process->deadline;
+            sprintf(tempStr, "  %s, OS: Process %d admitted with deadline %.0f ms\n",
+                    timeStr, process->number, process->deadline);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
+        }
+        else if (process->priority > 0)
+        {
+            sprintf(tempStr, "  %s, OS: Process %d deadline %d ms not admitted, runs without one\n",
+                    timeStr, process->number, process->priority);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
+        }
     }
-    // assume end of list not found yet
-    head->next = addNewPCB(head->next, number, priority, programCounter);
-    return head;
+
+    sprintf(tempStr, "  %s, OS: Admitted deadline utilization %.2f\n", timeStr, utilization);
+    outputLine(configData->logToCode, ouptutPtr, tempStr);
 }
 
-ProcessControlBlock *findNextReady(ProcessControlBlock *headPtr, int schedCode)
+/**
+ * @brief Sums up the EDF-P deadlines met and missed.
+ *
+ * @details Lateness is exit time less deadline, negative for a process
+ *          that finished early; only admitted processes are counted.
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] scheduler Scheduler
+ */
+void reportDeadlines(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler)
 {
-    while (headPtr != NULL)
+    char tempStr[MAX_STR_LEN];
+    char timeStr[MAX_STR_LEN];
+    ProcessControlBlock *process;
+    double maxLateness = 0.0;
+    int admitted = 0;
+    int missed = 0;
+    int index;
+
+    for (index = 0; index < scheduler->processCount; index++)
     {
-        if (headPtr->state == READY || headPtr->state == NEW)
+        process = &scheduler->processTable[index];
+        if (process->deadline != NA)
         {
-            return headPtr;
+            if (admitted == 0 || process->lateness > maxLateness)
+            {
+                maxLateness = process->lateness;
+            }
+            if (process->lateness > 0.0)
+            {
+                missed++;
+            }
+            admitted++;
         }
-        headPtr = headPtr->next;
     }
-    return NULL;
+
+    accessTimer(LAP_TIMER, timeStr);
+    sprintf(tempStr, "  %s, OS: %d of %d deadlines missed, maximum lateness %.0f ms\n",
+            timeStr, missed, admitted, maxLateness);
+    outputLine(configData->logToCode, ouptutPtr, tempStr);
 }
 
-Boolean waitingQueue(int code, int processNum)
+/**
+ * @brief Creates PCB objects from a precompiled image's process index.
+ *
+ * @details Each index entry gives the process's A(start) and the cycle
+ *          sums createProcesses would add up op code by op code. Only
+ *          the op codes inside each entry are visited, to fill the
+ *          burst table.
+ *
+ * @param[in] image Loaded precompiled image
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] burstTable Empty burst table, filled for every process
+ *
+ * @param[out] scheduler Scheduler whose process table stores each process
+ */
+void createIndexedProcesses(MetaDataImage *image, ConfigDataType *configData,
+                            BurstTable *burstTable, SchedulerType *scheduler)
 {
-    static ProcessControlBlock *headPtr = NULL;
+    ProcessIndexEntry *entry;
+    ProcessControlBlock *newProcess;
+    int index;
 
-    if (code == CHECK_QUEUE)
-    {
-        return (headPtr == NULL);
-    }
-    else if (code == ADD_NODE)
+    for (index = 0; index < image->processCount; index++)
     {
-        headPtr = addNewPCB(headPtr, processNum, NA, NULL);
+        entry = &image->processIndex[index];
+        newProcess = addNewPCB(scheduler, index,
+                               initialPriority(configData, index, &image->ops[entry->firstOp]),
+                               &image->ops[entry->firstOp]);
+        newProcess->timeRemaining = (double)entry->runCycles * configData->procCycleRate
+                                    + (double)entry->ioCycles * configData->ioCycleRate;
+        newProcess->totalTime = newProcess->timeRemaining;
+
+        // Table may still move; hold the first burst's index for now
+        newProcess->burstIndex = burstTable->count;
+        addProcessBursts(burstTable, &image->ops[entry->firstOp], configData);
     }
-    else if (code == DELETE_NODE)
+
+    for (index = 0; index < scheduler->processCount; index++)
     {
-        ProcessControlBlock *temp = headPtr;
-        headPtr = headPtr->next;
-        free(temp);
+        newProcess = &scheduler->processTable[index];
+        newProcess->bursts = &burstTable->bursts[newProcess->burstIndex];
+        newProcess->burstIndex = 0;
     }
-    return True;
 }
 
 /**
-  * @details Orders processes for SJF. If two processes have the same calculated
-  *          time, then they are ordered by FCFS-N.
+ * @brief Tops up the scheduler with processes from the metadata stream.
  *
- * @param[in] processArray[] ProcessControlBlock array that stores each process
+ * @details Takes processes in metadata order, waiting on the parser when
+ *          none is queued yet, until the stream ends or the table slot
+ *          the next process needs still holds a live process. The slot
+ *          belongs to the process created STREAM_PROCESS_WINDOW earlier,
+ *          so at most that many processes are admitted at once. Each
+ *          process gets a burst table of its own, and an exited
+ *          process's op block and bursts are freed as its slot is reused.
+ *          Streaming is only used for FCFS codes, so priority is arrival
+ *          order.
  *
- * @param[in] numProcesses Number of processes in processArray
+ * @param[in] stream Metadata stream
  *
- * @return none
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] scheduler Scheduler with a windowed process table
  */
-ProcessControlBlock *findMinimum(ProcessControlBlock *headPtr, int schedCode)
+void admitStreamedProcesses(ProcessStream *stream, ConfigDataType *configData,
+                            SchedulerType *scheduler)
 {
-    ProcessControlBlock *minimum = findNextReady(headPtr, schedCode);
-    headPtr = minimum->next;
-    while (headPtr != NULL)
+    StreamedProcess streamed;
+    BurstTable burstTable;
+    ProcessControlBlock *newProcess;
+    ProcessControlBlock *oldProcess;
+    int number = scheduler->processCount;
+
+    oldProcess = findPCB(scheduler, number - STREAM_PROCESS_WINDOW);
+    while ((oldProcess == NULL || oldProcess->state == EXIT)
+           && takeStreamedProcess(stream, &streamed))
     {
-        if (schedCode == CPU_SCHED_SJF_N_CODE)
-        {
-            if ((headPtr->totalTime < minimum->totalTime) && (headPtr->state == READY || headPtr->state == NEW))
-            {
-                minimum = headPtr;
-            }
-        }
-        else
+        if (oldProcess != NULL)
         {
-            if ((headPtr->timeRemaining < minimum->timeRemaining) && (headPtr->state == READY || headPtr->state == NEW))
-            {
-                minimum = headPtr;
-            }
+            free(oldProcess->opBlock);
+            free(oldProcess->bursts);
         }
-        headPtr = headPtr->next;
+
+        burstTable.bursts = NULL;
+        burstTable.count = 0;
+        burstTable.capacity = 0;
+
+        newProcess = addNewPCB(scheduler, number, number, streamed.ops);
+        newProcess->opBlock = streamed.ops;
+        newProcess->totalTime = addProcessBursts(&burstTable, streamed.ops, configData);
+        newProcess->timeRemaining = newProcess->totalTime;
+        newProcess->bursts = burstTable.bursts;
+        admitProcess(scheduler, newProcess);
+
+        number = scheduler->processCount;
+        oldProcess = findPCB(scheduler, number - STREAM_PROCESS_WINDOW);
+    }
+}
+
+/**
+ * @details Frees the op blocks and bursts of the streamed processes
+ *          still in the process table.
+ *
+ * @param[in] scheduler Scheduler with a windowed process table
+ */
+void releaseStreamedProcesses(SchedulerType *scheduler)
+{
+    int index;
+
+    for (index = 0; index < scheduler->processCount && index < scheduler->processWindow; index++)
+    {
+        free(scheduler->processTable[index].opBlock);
+        free(scheduler->processTable[index].bursts);
     }
-    return minimum;
 }
 
 /**
  * @brief Method that runs the current process.
  *
- * @details Sets the current process in RUNNING state, prepares the input for
- *          the thread runner method, calls the thread runner method for each
- *          op code until the end of the process (A(end)), subtracts the
+ * @details Sets the current process in RUNNING state, runs each op code
+ *          until the end of the process (A(end)), handing I/O ops to the
+ *          I/O pool, subtracts the
  *          time each op code ran from the time remaining, and sets the
  *          current process in EXIT state.
  *
@@ -369,12 +651,17 @@ ProcessControlBlock *findMinimum(ProcessControlBlock *headPtr, int schedCode)
  *
  * @param[in] configData Pointer to config data struct
  *
- * @param[out] ouptutPtr Ouptut linked list
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] scheduler Ready set the process is kept ordered in
+ *
+ * @param[in] ioPool I/O workers, unused with the virtual clock
  *
  * @return none
  */
-ProcessControlBlock *runProcess(ProcessControlBlock *currentProcess, ConfigDataType *configData,
-                                LogOutput *ouptutPtr, MemoryNode *memoryPtr, ProcessControlBlock *headPtr)
+void runProcess(ProcessControlBlock *currentProcess, ConfigDataType *configData,
+                LogOutput *ouptutPtr, MemoryList *memory, SchedulerType *scheduler,
+                IOPool *ioPool)
 {
     char tempStr[MAX_STR_LEN];
     char timeStr[MAX_STR_LEN];
@@ -382,43 +669,40 @@ ProcessControlBlock *runProcess(ProcessControlBlock *currentProcess, ConfigDataT
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: Process %d selected with %.0f ms remaining.\n",
             timeStr, currentProcess->number, currentProcess->timeRemaining);
-    ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+    outputLine(configData->logToCode, ouptutPtr, tempStr);
 
     accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: Process %d set in RUNNING state.\n", timeStr,
             currentProcess->number);
-    ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-    currentProcess->state = RUNNING;
+    outputLine(configData->logToCode, ouptutPtr, tempStr);
+    setProcessState(scheduler, currentProcess, RUNNING);
 
     Boolean preemption = True;
-    if ((configData->cpuSchedCode == CPU_SCHED_SJF_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE))
+    if ((configData->cpuSchedCode == CPU_SCHED_SJF_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_FCFS_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_PRIORITY_N_CODE))
     {
         preemption = False;
     }
 
-    char *opCodeName = currentProcess->programCounter->opName;
-    while ((currentProcess->programCounter != NULL) && (compareString(opCodeName, "end") != STR_EQ))
+    while (currentProcess->programCounter->opName != OP_END_CODE)
     {
         // Skip A(start)
-        if (compareString(opCodeName, "start") == STR_EQ)
+        if (currentProcess->programCounter->opName == OP_START_CODE)
         {
-            currentProcess->programCounter = currentProcess->programCounter->next;
-            opCodeName = currentProcess->programCounter->opName;
+            currentProcess->programCounter++;
         }
         else if (currentProcess->programCounter->opLtr == 'M')
         {
             int returnVal = memoryManager(*currentProcess, configData, ouptutPtr,
-                                          memoryPtr);
+                                          memory);
             if (returnVal == SEG_FAULT)
             {
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "  %s, Process: %d, experiences segmentation fault.\n",
                         timeStr, currentProcess->number);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
                 break;
             }
-            currentProcess->programCounter = currentProcess->programCounter->next;
-            opCodeName = currentProcess->programCounter->opName;
+            currentProcess->programCounter++;
         }
         else if (currentProcess->programCounter->opLtr == 'P')
         {
@@ -427,91 +711,117 @@ ProcessControlBlock *runProcess(ProcessControlBlock *currentProcess, ConfigDataT
             {
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "\n  %s, Process: %d, run operation start\n", timeStr, currentProcess->number);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
 
-                int cycleTime = calcCycleTime(currentProcess->programCounter, configData);
+                int cycleTime = nextBurstTime(currentProcess, configData);
                 runTimer(cycleTime);
-                currentProcess->timeRemaining -= cycleTime;
+                currentProcess->burstIndex++;
+                currentProcess->timeRemaining = remainingTime(currentProcess, configData);
 
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "  %s, Process: %d, run operation end\n", timeStr, currentProcess->number);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
 
-                currentProcess->programCounter = currentProcess->programCounter->next;
-                opCodeName = currentProcess->programCounter->opName;
+                currentProcess->programCounter++;
             }
             //Preemption
             else
             {
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "\n  %s, Process: %d, run operation start\n", timeStr, currentProcess->number);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
 
                 int remainingQuantum = configData->quantumCycles;
-                while ((remainingQuantum > 0) && (currentProcess->programCounter->opValue > 0) && (interruptManager(CHECK_FOR_INTERRUPTS, NA, NA, NULL, NULL, NULL, headPtr, NA) == NULL))
+                if (configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE)
+                {
+                    remainingQuantum = configData->mlfqQuanta[currentProcess->level];
+                }
+                else if (configData->cpuSchedCode == CPU_SCHED_FAIR_P_CODE)
+                {
+                    remainingQuantum = fairSliceCycles(configData, scheduler);
+                }
+                Burst *burst = &currentProcess->bursts[currentProcess->burstIndex];
+                while ((remainingQuantum > 0) && (currentProcess->burstCycles < burst->cycles) && (interruptManager(CHECK_FOR_INTERRUPTS, NA, NA, NULL, NULL, NULL, NA, NULL) == False))
                 {
                     runTimer(configData->procCycleRate);
-                    (currentProcess->programCounter->opValue)--;
+                    currentProcess->burstCycles++;
                     remainingQuantum--;
-                    currentProcess->timeRemaining = currentProcess->timeRemaining - configData->procCycleRate;
+                    currentProcess->timeRemaining = remainingTime(currentProcess, configData);
+                    readyQueueUpdate(scheduler, currentProcess);
+                    chargeRuntime(scheduler, currentProcess, configData->procCycleRate);
                 }
 
                 // If the run operation ended
-                if (currentProcess->programCounter->opValue == 0)
+                if (currentProcess->burstCycles >= burst->cycles)
                 {
+                    currentProcess->burstIndex++;
+                    currentProcess->burstCycles = 0;
+
                     accessTimer(LAP_TIMER, timeStr);
                     sprintf(tempStr, "  %s, Process: %d, run operation end\n", timeStr, currentProcess->number);
-                    ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                    outputLine(configData->logToCode, ouptutPtr, tempStr);
+
+                    // A run that used its whole MLFQ quantum still counts against it
+                    if ((configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE) && (remainingQuantum == 0))
+                    {
+                        demoteProcess(currentProcess, configData, ouptutPtr, scheduler);
+                    }
 
                     accessTimer(LAP_TIMER, timeStr);
                     sprintf(tempStr, "\n  %s, Process: %d, set in READY state\n", timeStr, currentProcess->number);
-                    ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-                    currentProcess->state = READY;
+                    outputLine(configData->logToCode, ouptutPtr, tempStr);
+                    setProcessState(scheduler, currentProcess, READY);
 
-                    currentProcess->programCounter = currentProcess->programCounter->next;
-                    opCodeName = currentProcess->programCounter->opName;
+                    currentProcess->programCounter++;
                     // break out of loop?
-                    // Append process to PCB list if RR-P
+                    // Send process to the back of the ready queue if RR-P
                     if (configData->cpuSchedCode == CPU_SCHED_RR_P_CODE)
                     {
-                        headPtr = reorderPCBList(headPtr, currentProcess->number);
+                        requeueProcess(scheduler, currentProcess);
                     }
-                    return headPtr;
+                    return;
                 }
 
                 // If we broke out of the loop and there is an interrupt to resolve
-                if (interruptManager(CHECK_FOR_INTERRUPTS, NA, NA, NULL, NULL, NULL, headPtr, NA) != NULL)
+                if (interruptManager(CHECK_FOR_INTERRUPTS, NA, NA, NULL, NULL, NULL, NA, NULL) == True)
                 {
                     // Resolve interrupts
-                    headPtr = interruptManager(RESOLVE_INTERRUPTS, currentProcess->number, NA, NULL, ouptutPtr, configData, headPtr, NA);
+                    interruptManager(RESOLVE_INTERRUPTS, currentProcess->number, NA, NULL, ouptutPtr, configData, NA, scheduler);
 
-                    // Append process to PCB list if RR-P
+                    // Send process to the back of the ready queue if RR-P
                     if (configData->cpuSchedCode == CPU_SCHED_RR_P_CODE)
                     {
-                        headPtr = reorderPCBList(headPtr, currentProcess->number);
+                        requeueProcess(scheduler, currentProcess);
                     }
-                    return headPtr;
+                    return;
+                }
+
+                // MLFQ-P, FAIR-P, and the ticket codes give up the CPU when the slice runs out mid-operation
+                if ((configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_FAIR_P_CODE)
+                    || (configData->cpuSchedCode == CPU_SCHED_STRIDE_P_CODE) || (configData->cpuSchedCode == CPU_SCHED_LOTTERY_P_CODE))
+                {
+                    accessTimer(LAP_TIMER, timeStr);
+                    sprintf(tempStr, "  %s, Process: %d, run operation quantum expired\n", timeStr, currentProcess->number);
+                    outputLine(configData->logToCode, ouptutPtr, tempStr);
+
+                    if (configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE)
+                    {
+                        demoteProcess(currentProcess, configData, ouptutPtr, scheduler);
+                    }
+
+                    accessTimer(LAP_TIMER, timeStr);
+                    sprintf(tempStr, "\n  %s, Process: %d, set in READY state\n", timeStr, currentProcess->number);
+                    outputLine(configData->logToCode, ouptutPtr, tempStr);
+                    setProcessState(scheduler, currentProcess, READY);
+                    return;
                 }
             }
         }
         else if ((currentProcess->programCounter->opLtr == 'I') || (currentProcess->programCounter->opLtr == 'O'))
         {
-            // Create thread variables
-            pthread_t threadID;
-            pthread_attr_t threadAttr;
-            pthread_attr_init(&threadAttr);
-            pthread_mutex_t mutexLock;
-            pthread_mutex_init(&mutexLock, NULL);
-
-            // Create thread input struct
-            TimerRunnerStruct threadInput;
-            threadInput.configData = configData;
-            threadInput.processNum = currentProcess->number;
-            threadInput.mutexLock = &mutexLock;
-            threadInput.opCode = currentProcess->programCounter;
-
+            double cycleTime = nextBurstTime(currentProcess, configData);
             char opString[MAX_STR_LEN];
-            copyString(opString, currentProcess->programCounter->opName);
+            opNameToString(currentProcess->programCounter->opName, opString);
             switch (currentProcess->programCounter->opLtr)
             {
             case 'I':
@@ -523,128 +833,241 @@ ProcessControlBlock *runProcess(ProcessControlBlock *currentProcess, ConfigDataT
             }
             accessTimer(LAP_TIMER, timeStr);
             sprintf(tempStr, "\n  %s, Process: %d, %s start\n", timeStr, currentProcess->number, opString);
-            ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
 
-            // Run thread
+            // Run I/O op
             if (!preemption)
             {
-                pthread_create(&threadID, &threadAttr, timerRunner, &threadInput);
-                pthread_join(threadID, NULL);
-                currentProcess->timeRemaining -= threadInput.cycleTime;
+                // Virtual clock advances in place; real clock waits on a pool worker
+                if (configData->clockCode == CLOCK_VIRTUAL_CODE)
+                {
+                    runTimer(cycleTime);
+                }
+                else
+                {
+                    submitIORequest(ioPool, currentProcess->number, cycleTime, opString);
+                    waitForIOPool(ioPool);
+                }
+                currentProcess->burstIndex++;
+                currentProcess->timeRemaining = remainingTime(currentProcess, configData);
 
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "  %s, Process: %d, %s end\n", timeStr, currentProcess->number, opString);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
 
-                currentProcess->programCounter = currentProcess->programCounter->next;
-                opCodeName = currentProcess->programCounter->opName;
+                currentProcess->programCounter++;
             }
             else
             {
                 sprintf(tempStr, "Process: %d, %s end\n\n", currentProcess->number, opString);
-                copyString(threadInput.outputStr, tempStr);
-                double cycleTime = calcCycleTime(currentProcess->programCounter, configData);
-                threadInput.cycleTime = cycleTime;
 
-                pthread_create(&threadID, &threadAttr, timerRunnerPremptive, &threadInput);
-                currentProcess->timeRemaining = currentProcess->timeRemaining - cycleTime;
+                // Virtual clock schedules the completion instead of waiting on a thread
+                if (configData->clockCode == CLOCK_VIRTUAL_CODE)
+                {
+                    interruptManager(SCHEDULE_INTERRUPT, NA, currentProcess->number, tempStr, NULL, NULL, cycleTime, NULL);
+                }
+                else
+                {
+                    submitIORequest(ioPool, currentProcess->number, cycleTime, tempStr);
+                }
+                currentProcess->burstIndex++;
+                currentProcess->timeRemaining = remainingTime(currentProcess, configData);
 
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "\n  %s, OS: Process %d set in BLOCKED state.\n", timeStr,
                         currentProcess->number);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-                currentProcess->state = BLOCKED;
-                waitingQueue(ADD_NODE, currentProcess->number);
-                currentProcess->programCounter = currentProcess->programCounter->next;
-                return headPtr;
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
+                setProcessState(scheduler, currentProcess, BLOCKED);
+                currentProcess->programCounter++;
+                return;
             }
         }
     }
 
-    accessTimer(LAP_TIMER, timeStr);
+    double exitTime = accessTimer(LAP_TIMER, timeStr);
     sprintf(tempStr, "  %s, OS: Process %d ended and set in EXIT state.\n",
             timeStr, currentProcess->number);
-    ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-    currentProcess->state = EXIT;
-    return headPtr;
+    outputLine(configData->logToCode, ouptutPtr, tempStr);
+    setProcessState(scheduler, currentProcess, EXIT);
+
+    if (currentProcess->deadline != NA)
+    {
+        currentProcess->lateness = exitTime * 1000.0 - currentProcess->deadline;
+        if (currentProcess->lateness > 0.0)
+        {
+            sprintf(tempStr, "  %s, OS: Process %d missed its deadline by %.0f ms\n",
+                    timeStr, currentProcess->number, currentProcess->lateness);
+        }
+        else
+        {
+            sprintf(tempStr, "  %s, OS: Process %d met its deadline with %.0f ms to spare\n",
+                    timeStr, currentProcess->number, -currentProcess->lateness);
+        }
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
+    }
 }
 
-// Append PCB to end of list for RR-P
-ProcessControlBlock *reorderPCBList(ProcessControlBlock *headPtr, int processNum)
+/**
+ * @brief Moves an MLFQ-P process down a level.
+ *
+ * @details Called when the process used its whole quantum. A process on
+ *          the bottom level stays there.
+ *
+ * @param[in] process Running process
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] scheduler Scheduler
+ */
+void demoteProcess(ProcessControlBlock *process, ConfigDataType *configData,
+                   LogOutput *ouptutPtr, SchedulerType *scheduler)
 {
-    ProcessControlBlock *temp = headPtr;
-    ProcessControlBlock *foundPCB = NULL;
-    ProcessControlBlock *prev = headPtr;
+    char tempStr[MAX_STR_LEN];
+    char timeStr[MAX_STR_LEN];
 
-    while (temp != NULL)
+    if (process->level < configData->mlfqLevels - 1)
     {
-        if (temp->number == processNum)
-        {
-            foundPCB = temp;
+        setProcessLevel(scheduler, process, process->level + 1);
 
-            // If foundPCB is the first in the list
-            if (prev->number == foundPCB->number)
-            {
-                headPtr = foundPCB->next;
-                foundPCB->next = NULL;
-                break;
-            }
-            // If foundPCB is in the middle of the list
-            else if (foundPCB->next != NULL)
-            {
-                //                headPtr = foundPCB->next;
-                prev->next = foundPCB->next;
-                foundPCB->next = NULL;
-                break;
-            }
-            // If foundPCB is at end of list
-            // We do not need to reorder
-            else
-            {
-                temp = NULL;
-            }
-        }
-        else
+        accessTimer(LAP_TIMER, timeStr);
+        sprintf(tempStr, "  %s, OS: Process %d demoted to level %d.\n",
+                timeStr, process->number, process->level);
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
+    }
+}
+
+/**
+ * @brief Reports the CPU time each ticket process got against what it was owed.
+ *
+ * @details Covers the whole run. A process is owed its tickets' share of
+ *          every ms run while it was READY or RUNNING, so one left alone
+ *          on the CPU is owed all of it. Processes whose table slot was
+ *          reused are left out.
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] scheduler Scheduler
+ */
+void reportCpuShares(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler)
+{
+    char tempStr[MAX_STR_LEN];
+    char timeStr[MAX_STR_LEN];
+    ProcessControlBlock *process;
+    int number;
+
+    accessTimer(LAP_TIMER, timeStr);
+    for (number = 0; number < scheduler->processCount; number++)
+    {
+        process = findPCB(scheduler, number);
+        if (process != NULL)
         {
-            prev = temp;
-            temp = temp->next;
+            sprintf(tempStr, "  %s, OS: Process %d CPU time %.1f ms, expected %.1f ms (%d tickets)\n",
+                    timeStr, process->number, process->cpuTime,
+                    process->expectedCpuTime, process->priority);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
         }
     }
-    // Append to end of list if foundPCB wasn't already at the end
-    if (temp != NULL)
+}
+
+/**
+ * @brief Cycles a FAIR-P process may run before giving up the CPU.
+ *
+ * @details The target latency is split evenly over the running process
+ *          and every READY one, but never below the minimum granularity,
+ *          so a long ready set does not shrink slices to a cycle.
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @param[in] scheduler Scheduler
+ *
+ * @return int Slice length in cycles, at least one
+ */
+int fairSliceCycles(ConfigDataType *configData, SchedulerType *scheduler)
+{
+    int slice = configData->fairLatency / (stateCount(scheduler, READY) + 1);
+    int cycles;
+
+    if (slice < configData->fairGranularity)
     {
-        temp = getLastNode(headPtr);
-        temp->next = foundPCB;
+        slice = configData->fairGranularity;
     }
-    return headPtr;
+    cycles = slice / configData->procCycleRate;
+    return (cycles < 1) ? 1 : cycles;
 }
 
-ProcessControlBlock *interruptManager(int interruptCode, int interruptedProcess, int processNum,
-                                      char *outputString, LogOutput *ouptutPtr, ConfigDataType *configData, ProcessControlBlock *headPtr, int cycleTime)
+/**
+ * @brief Manages pending I/O interrupts.
+ *
+ * @details Adds, schedules, checks for, and resolves interrupts
+ *          depending on interruptCode.
+ *
+ * @return Boolean Returns True if interrupts are still pending
+ */
+Boolean interruptManager(int interruptCode, int interruptedProcess, int processNum,
+                         char *outputString, LogOutput *ouptutPtr, ConfigDataType *configData, int cycleTime,
+                         SchedulerType *scheduler)
 {
     char tempStr[MAX_STR_LEN];
     char timeStr[MAX_STR_LEN];
-    static InterruptNode *interruptHead = NULL;
+    // Completions posted by the I/O pool or released by the virtual clock
+    static InterruptQueue interruptQueue = INTERRUPT_QUEUE_INITIALIZER(&simArena);
+    InterruptNode *interruptHead;
+    // I/O completions pending on the virtual clock
+    static EventQueue eventQueue;
+    SimEvent event;
+    long long eventTime;
 
     if (interruptCode == CHECK_FOR_INTERRUPTS)
     {
-        if (interruptHead == NULL)
+        // Release completions the virtual clock has reached
+        while (popDueEvent(&eventQueue, getTimerNanoSec(), &event))
+        {
+            postInterrupt(&interruptQueue, event.processNum, event.cycleTime, event.outputStr);
+        }
+    }
+    else if (interruptCode == ADD_NODE)
+    {
+        postInterrupt(&interruptQueue, processNum, cycleTime, outputString);
+    }
+    else if (interruptCode == SCHEDULE_INTERRUPT)
+    {
+        pushEvent(&eventQueue, getTimerNanoSec() + (long long)cycleTime * 1000000LL,
+                  processNum, cycleTime, outputString);
+    }
+    else if (interruptCode == WAIT_FOR_INTERRUPTS)
+    {
+        // Virtual clock has no I/O threads to wait on; jump straight
+        // to the next completion and release it instead
+        if (configData->clockCode == CLOCK_VIRTUAL_CODE)
         {
-            return NULL;
+            if (nextEventTime(&eventQueue, &eventTime))
+            {
+                advanceTimerTo(eventTime);
+            }
+            while (popDueEvent(&eventQueue, getTimerNanoSec(), &event))
+            {
+                postInterrupt(&interruptQueue, event.processNum, event.cycleTime, event.outputStr);
+            }
         }
         else
         {
-            // Return headPtr because we need to return a PCB and this will tell
-            // the calling the method that the interruptHead is not NULL
-            return headPtr;
+            waitForInterrupts(&interruptQueue);
         }
     }
-    else if (interruptCode == ADD_NODE)
+    else if (interruptCode == CLEAR_INTERRUPTS)
     {
-        interruptHead = addNewInterruptNode(interruptHead, processNum, cycleTime, outputString);
+        clearEventQueue(&eventQueue);
+        clearInterruptQueue(&interruptQueue);
     }
     else
     {
+        // Take every pending interrupt in one swap, again if more arrived meanwhile
+        interruptHead = drainInterrupts(&interruptQueue);
         while (interruptHead != NULL)
         {
             InterruptNode *temp = interruptHead;
@@ -655,7 +1078,7 @@ ProcessControlBlock *interruptManager(int interruptCode, int interruptedProcess,
                 accessTimer(LAP_TIMER, timeStr);
                 sprintf(tempStr, "  %s, OS: Interrupt called by process %d.\n",
                         timeStr, interruptHead->processNum);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
             }
             // If process was interrupted
             else
@@ -664,91 +1087,54 @@ ProcessControlBlock *interruptManager(int interruptCode, int interruptedProcess,
                 sprintf(tempStr, "  %s, OS: Process %d interrupted by process %d.",
                         timeStr, interruptedProcess, interruptHead->processNum);
                 accessTimer(LAP_TIMER, timeStr);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
 
                 sprintf(tempStr, "\n  %s, OS: Process %d put in READY state.\n\n",
                         timeStr, interruptedProcess);
-                ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-                findPCB(headPtr, interruptedProcess)->state = READY;
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
+                setProcessState(scheduler, findPCB(scheduler, interruptedProcess), READY);
             }
 
             accessTimer(LAP_TIMER, timeStr);
             sprintf(tempStr, "  %s, %s", timeStr, interruptHead->outputStr);
-            ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
 
             accessTimer(LAP_TIMER, timeStr);
             sprintf(tempStr, "  %s, OS: Process %d put in READY state.\n",
                     timeStr, interruptHead->processNum);
-            ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
 
             // Subtract cycle time and set process to ready
-            ProcessControlBlock *process = findPCB(headPtr, interruptHead->processNum);
+            ProcessControlBlock *process = findPCB(scheduler, interruptHead->processNum);
             // process->timeRemaining = process->timeRemaining - interruptHead->cycleTime;
-            process->state = READY;
 
-            // Append process to end of PCB list if RR-P
+            // MLFQ-P moves a process that gave up the CPU for I/O up a level
+            if ((configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE) && (process->level > 0))
+            {
+                setProcessLevel(scheduler, process, process->level - 1);
+
+                accessTimer(LAP_TIMER, timeStr);
+                sprintf(tempStr, "  %s, OS: Process %d promoted to level %d.\n",
+                        timeStr, process->number, process->level);
+                outputLine(configData->logToCode, ouptutPtr, tempStr);
+            }
+            setProcessState(scheduler, process, READY);
+
+            // Send process to the back of the ready queue if RR-P
             if (configData->cpuSchedCode == CPU_SCHED_RR_P_CODE)
             {
-                headPtr = reorderPCBList(headPtr, interruptHead->processNum);
+                requeueProcess(scheduler, process);
             }
 
-            waitingQueue(DELETE_NODE, NA);
             interruptHead = interruptHead->next;
-            free(temp);
-        }
-        return headPtr;
-    }
-    return NULL;
-}
-
-ProcessControlBlock *findPCB(ProcessControlBlock *headPtr, int processNum)
-{
-    while (headPtr != NULL)
-    {
-        if (headPtr->number == processNum)
-        {
-            return headPtr;
-        }
-        headPtr = headPtr->next;
-    }
-    return NULL;
-}
-
-ProcessControlBlock *clearPCBList(ProcessControlBlock *head)
-{
-    if (head != NULL)
-    {
-        if (head->next != NULL)
-        {
-            clearPCBList(head->next);
+            releaseInterrupt(&interruptQueue, temp);
+            if (interruptHead == NULL)
+            {
+                interruptHead = drainInterrupts(&interruptQueue);
+            }
         }
-        free(head);
     }
-    return NULL;
-}
-
-InterruptNode *addNewInterruptNode(InterruptNode *head, int processNum, int cycleTime, char *outputString)
-{
-    if (head == NULL)
-    {
-        head = (InterruptNode *)malloc(sizeof(InterruptNode));
-        copyString(head->outputStr, outputString);
-        head->processNum = processNum;
-        head->cycleTime = cycleTime;
-        head->next = NULL;
-        return head;
-    }
-    // Do not add an interrupt for the same process if one already exists
-    // Was getting weird behavior with threads where one thread was
-    // creating multiple interrupts
-    // if(head->processNum == processNum)
-    // {
-    //     return head;
-    // }
-    // assume end of list not found yet
-    head->next = addNewInterruptNode(head->next, processNum, cycleTime, outputString);
-
-    return head;
+    return interruptsPending(&interruptQueue);
 }
 
 /**
@@ -761,14 +1147,14 @@ InterruptNode *addNewInterruptNode(InterruptNode *head, int processNum, int cycl
  *
  * @param[in] configData Pointer to config data struct
  *
- * @param[out] ouptutPtr Ouptut linked list
+ * @param[out] ouptutPtr Ouptut log
  *
- * @param[out] memoryPtr Memory linked list
+ * @param[out] memory Memory list
  *
  * @return int Returns SEG_FAULT or NO_ERROR
  */
 int memoryManager(ProcessControlBlock process, ConfigDataType *configData,
-                  LogOutput *ouptutPtr, MemoryNode *memoryPtr)
+                  LogOutput *ouptutPtr, MemoryList *memory)
 {
     char tempStr[MAX_STR_LEN];
     char timeStr[MAX_STR_LEN];
@@ -777,51 +1163,51 @@ int memoryManager(ProcessControlBlock process, ConfigDataType *configData,
     int base = (process.programCounter->opValue / 1000) % 1000;
     int offset = process.programCounter->opValue % 1000;
 
-    if (compareString(process.programCounter->opName, "allocate") == STR_EQ)
+    switch (process.programCounter->opName)
     {
+    case OP_ALLOCATE_CODE:
         accessTimer(LAP_TIMER, timeStr);
         sprintf(tempStr, "  %s, Process: %d, MMU attempt to allocate %d/%d/%d.\n",
                 timeStr, process.number, identifier, base, offset);
-        ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
 
         // Convert config data memory available to MB and compare it
         // to the base of the allocation
-        if ((!memorySpaceFree(memoryPtr, base, process.number, identifier)) || (base > configData->memAvailable / 1024))
+        if ((!memorySpaceFree(memory, base, process.number, identifier)) || (base > configData->memAvailable / 1024))
         {
             accessTimer(LAP_TIMER, timeStr);
             sprintf(tempStr, "  %s, Process: %d, MMU failed to allocate.\n",
                     timeStr, process.number);
-            ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
             return SEG_FAULT;
         }
         // Allocation successful
-        memoryPtr = addNewMemoryNode(memoryPtr, identifier, base, offset,
-                                     process.number);
+        addNewMemoryNode(memory, identifier, base, offset, process.number);
         accessTimer(LAP_TIMER, timeStr);
         sprintf(tempStr, "  %s, Process: %d, MMU successful allocate.\n",
                 timeStr, process.number);
-        ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
-    }
-    else if (compareString(process.programCounter->opName, "access") == STR_EQ)
-    {
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
+        break;
+    case OP_ACCESS_CODE:
         accessTimer(LAP_TIMER, timeStr);
         sprintf(tempStr, "  %s, Process: %d, MMU attempt to access %d/%d/%d.\n",
                 timeStr, process.number, identifier, base, offset);
-        ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
 
-        if (!requestMemory(memoryPtr, process.number, identifier, base, offset))
+        if (!requestMemory(memory, process.number, identifier, base, offset))
         {
             accessTimer(LAP_TIMER, timeStr);
             sprintf(tempStr, "  %s, Process: %d, MMU failed to access.\n",
                     timeStr, process.number);
-            ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+            outputLine(configData->logToCode, ouptutPtr, tempStr);
             return SEG_FAULT;
         }
         // Access successful
         accessTimer(LAP_TIMER, timeStr);
         sprintf(tempStr, "  %s, Process: %d, MMU successful access.\n",
                 timeStr, process.number);
-        ouptutPtr = outputLine(configData->logToCode, ouptutPtr, tempStr);
+        outputLine(configData->logToCode, ouptutPtr, tempStr);
+        break;
     }
     return NO_ERR;
 }
@@ -830,7 +1216,7 @@ int memoryManager(ProcessControlBlock process, ConfigDataType *configData,
  * @details Checks if memory space is already allocated and if the memory
  *           identifier has already been used for the process running.
  *
- * @param[in] memoryPtr Memory head pointer
+ * @param[in] memory Memory list
  *
  * @param[in] memoryBase Memory size requesting to be allocated.
  *
@@ -841,18 +1227,19 @@ int memoryManager(ProcessControlBlock process, ConfigDataType *configData,
  * @return Boolean Returns True memory space is free. Returns False
  *                 if memory space has already been allocated.
  */
-Boolean memorySpaceFree(MemoryNode *memoryPtr, int memoryBase, int processNum,
+Boolean memorySpaceFree(MemoryList *memory, int memoryBase, int processNum,
                         int memoryIdentifier)
 {
-    if (memoryPtr == NULL)
-    {
-        return True;
-    }
-    else if ((memoryPtr->base == memoryBase) || (memoryPtr->processNum == processNum && memoryPtr->identifier == memoryIdentifier))
+    MemoryNode *memoryPtr;
+
+    for (memoryPtr = memory->head; memoryPtr != NULL; memoryPtr = memoryPtr->next)
     {
-        return False;
+        if ((memoryPtr->base == memoryBase) || (memoryPtr->processNum == processNum && memoryPtr->identifier == memoryIdentifier))
+        {
+            return False;
+        }
     }
-    return memorySpaceFree(memoryPtr->next, memoryBase, processNum, memoryIdentifier);
+    return True;
 }
 
 /**
@@ -861,7 +1248,7 @@ Boolean memorySpaceFree(MemoryNode *memoryPtr, int memoryBase, int processNum,
  *          Finds requested memory matching the process number, base,
  *          and identifier.
  *
- * @param[in] memoryPtr Memory head pointer
+ * @param[in] memory Memory list
  *
  * @param[in] processNum Process that is currently running
  *
@@ -875,36 +1262,43 @@ Boolean memorySpaceFree(MemoryNode *memoryPtr, int memoryBase, int processNum,
  *                 memory. Returns False if access called before allocate or
  *                 there is not enough memory allocated for requested memory.
  */
-Boolean requestMemory(MemoryNode *memoryPtr, int processNum, int identifier,
+Boolean requestMemory(MemoryList *memory, int processNum, int identifier,
                       int base, int offset)
-{ // If requested memory has not been found or we have not added
-    // any nodes to the memory list besides the placeholder node.
-    if (memoryPtr == NULL || memoryPtr->identifier == NA)
-    {
-        return False;
-    }
-    else if ((memoryPtr->processNum == processNum) && (memoryPtr->base == base) && (memoryPtr->identifier == identifier))
+{
+    MemoryNode *memoryPtr;
+
+    for (memoryPtr = memory->head; memoryPtr != NULL; memoryPtr = memoryPtr->next)
     {
-        if (offset <= memoryPtr->offset)
-        {
-            return True;
-        }
-        else
+        if ((memoryPtr->processNum == processNum) && (memoryPtr->base == base) && (memoryPtr->identifier == identifier))
         {
-            return False;
+            return (offset <= memoryPtr->offset);
         }
     }
-    return requestMemory(memoryPtr->next, processNum, identifier, base, offset);
+    // Access called before allocate
+    return False;
+}
+
+/**
+ * @brief Initializes an empty memory list.
+ *
+ * @param[out] memory Memory list
+ *
+ * @param[in] arena Arena the memory nodes are carved from
+ */
+void initMemoryList(MemoryList *memory, Arena *arena)
+{
+    memory->head = NULL;
+    memory->tail = NULL;
+    initSlabCache(&memory->nodes, arena, sizeof(MemoryNode));
 }
 
 /**
  * @brief Creates new memory node.
  *
- * @details Checks if the local head pointer is NULL. If so, creates
- *          new node to be the head pointer. If not, adds new node to end of
- *          linked list.
+ * @details Takes a node from the slab cache and appends it at the tail,
+ *          keeping allocation order. O(1).
  *
- * @param[in] head MemoryNode head pointer
+ * @param[in] memory Memory list
  *
  * @param[in] memoryID New node identifier
  *
@@ -913,60 +1307,42 @@ Boolean requestMemory(MemoryNode *memoryPtr, int processNum, int identifier,
  * @param[in] memoryOffset New node offset
  *
  * @param[in] processNum Current process running
- *
- * @return MemoryNode Head of linked list
  */
-MemoryNode *addNewMemoryNode(MemoryNode *head, int memoryID, int memoryBase,
-                             int memoryOffset, int processNum)
+void addNewMemoryNode(MemoryList *memory, int memoryID, int memoryBase,
+                      int memoryOffset, int processNum)
 {
-    if (head == NULL)
+    MemoryNode *newNode = (MemoryNode *)slabAlloc(&memory->nodes);
+
+    newNode->processNum = processNum;
+    newNode->identifier = memoryID;
+    newNode->base = memoryBase;
+    newNode->offset = memoryOffset;
+    newNode->next = NULL;
+
+    if (memory->tail == NULL)
     {
-        head = (MemoryNode *)malloc(sizeof(MemoryNode));
-        head->processNum = processNum;
-        head->identifier = memoryID;
-        head->base = memoryBase;
-        head->offset = memoryOffset;
-        head->next = NULL;
-        return head;
+        memory->head = newNode;
     }
-    // First node will be a placeholder, so overwrite its values
-    // with a real memory node
-    else if (head->processNum == NA)
+    else
     {
-        (*head).processNum = processNum;
-        (*head).identifier = memoryID;
-        (*head).base = memoryBase;
-        (*head).offset = memoryOffset;
-        (*head).next = NULL;
-        return head;
+        memory->tail->next = newNode;
     }
-    // assume end of list not found yet
-    head->next = addNewMemoryNode(head->next, memoryID, memoryBase,
-                                  memoryOffset, processNum);
-    return head;
+    memory->tail = newNode;
 }
 
 /**
- * @brief Clears memory linked list.
- *
- * @details Recursively iterates through MemoryNode linked list and
-           returns memory to OS from the bottom of the list upward.
+ * @brief Clears memory list.
  *
- * @param[in] head Memory list head pointer
+ * @details Empties the list without visiting its nodes, which belong to
+ *          the arena and are released with it.
  *
- * @return MemoryNode Head pointer, which should be NULL
+ * @param[in] memory Memory list
  */
-MemoryNode *clearMemoryList(MemoryNode *head)
+void clearMemoryList(MemoryList *memory)
 {
-    if (head != NULL)
-    {
-        if (head->next != NULL)
-        {
-            clearMemoryList(head->next);
-        }
-        free(head);
-    }
-    return NULL;
+    memory->head = NULL;
+    memory->tail = NULL;
+    resetSlabCache(&memory->nodes);
 }
 
 /**
@@ -991,52 +1367,153 @@ double calcCycleTime(OpCodeType *opCode, ConfigDataType *configData)
 }
 
 /**
- * @details Handles output depending on logToCode.
- *          If logToCode is MONITOR, prints string.
- *          If logToCode is FILE, saves string to buffer.
- *          If logToCode is BOTH, prints and saves string to buffer.
- *          Note: the string is always added to the buffer to not mess up the
- *          output head pointer, but only outputted to file at end if
- *          logToCode is FILE or BOTH.
+ * @brief Adds an op code to the end of a burst table.
  *
- * @param[in] logToCode Config data log to code
+ * @details Times the op code once and records it with the time of every
+ *          burst before it. Amortized O(1).
  *
- * @param[out] ouptutPtr Ouptut linked list
+ * @param[out] burstTable Burst table
  *
- * @param[in] inputStr string to be outputted
+ * @param[in] opCode Timed op code
+ *
+ * @param[in] configData Pointer to config data struct
  *
- * @return LogOutput Head of linked list
+ * @return double The op code's cycle time
  */
-LogOutput *outputLine(int logToCode, LogOutput *ouptutPtr, char *inputStr)
+double addBurst(BurstTable *burstTable, OpCodeType *opCode, ConfigDataType *configData)
 {
-    ouptutPtr = addNewStrNode(ouptutPtr, inputStr);
+    Burst *burst;
+    double startTime = 0.0;
 
-    if (logToCode != LOGTO_FILE_CODE)
+    if (burstTable->count > 0)
     {
-        printf("%s", inputStr);
+        burst = &burstTable->bursts[burstTable->count - 1];
+        startTime = burst->startTime + burst->time;
+    }
+
+    if (burstTable->count == burstTable->capacity)
+    {
+        burstTable->capacity = (burstTable->capacity == 0) ? 64 : burstTable->capacity * 2;
+        burstTable->bursts = (Burst *)realloc(burstTable->bursts,
+                                              burstTable->capacity * sizeof(Burst));
     }
-    return ouptutPtr;
+
+    burst = &burstTable->bursts[burstTable->count];
+    burstTable->count++;
+    burst->cycles = opCode->opValue;
+    burst->time = calcCycleTime(opCode, configData);
+    burst->startTime = startTime;
+    return burst->time;
 }
 
 /**
- * @details Outputs buffer to the log file.
+ * @brief Adds one process's op codes to a burst table.
  *
- * @param[out] ouptutPtr Ouptut linked list
+ * @details Walks the op codes runProcess would, from the op code after
+ *          A(start) up to and including the first end op code, adding
+ *          every op code other than memory and start op codes.
  *
- * @param[in] outputFileName The name of the output log file
+ * @param[out] burstTable Burst table
  *
- * @return none
+ * @param[in] processStart The process's A(start)
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @return double Total cycle time of the bursts added
  */
-void outputToFile(LogOutput *ouptutPtr, char *outputFileName)
+double addProcessBursts(BurstTable *burstTable, OpCodeType *processStart,
+                        ConfigDataType *configData)
 {
-    FILE *outputFile = fopen(outputFileName, "w");
+    OpCodeType *opCode = processStart;
+    double totalTime = 0.0;
 
-    while (ouptutPtr != NULL)
+    do
     {
-        fprintf(outputFile, "%s", ouptutPtr->outputStr);
-        ouptutPtr = ouptutPtr->next;
+        opCode++;
+        if ((opCode->opLtr != 'M') && (opCode->opName != OP_START_CODE))
+        {
+            totalTime += addBurst(burstTable, opCode, configData);
+        }
+    } while (opCode->opName != OP_END_CODE);
+
+    return totalTime;
+}
+
+/**
+ * @details Frees a burst table's bursts.
+ *
+ * @param[in] burstTable Burst table
+ */
+void clearBurstTable(BurstTable *burstTable)
+{
+    free(burstTable->bursts);
+    burstTable->bursts = NULL;
+    burstTable->count = 0;
+    burstTable->capacity = 0;
+}
+
+/**
+ * @brief Time a process has left.
+ *
+ * @details Subtracts the bursts already run, read off the prefix sums,
+ *          and the cycles run of the current burst from the process's
+ *          total. O(1).
+ *
+ * @param[in] process Process with a burst table
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @return double Remaining time in ms
+ */
+double remainingTime(ProcessControlBlock *process, ConfigDataType *configData)
+{
+    double timeRun = process->bursts[process->burstIndex].startTime
+                     - process->bursts[0].startTime;
+
+    return process->totalTime - timeRun
+           - (double)process->burstCycles * configData->procCycleRate;
+}
+
+/**
+ * @brief Time left in the burst a process runs next.
+ *
+ * @details A partly run P op code only has its remaining cycles left.
+ *          O(1).
+ *
+ * @param[in] process Process with a burst table
+ *
+ * @param[in] configData Pointer to config data struct
+ *
+ * @return double Burst time in ms
+ */
+double nextBurstTime(ProcessControlBlock *process, ConfigDataType *configData)
+{
+    Burst *burst = &process->bursts[process->burstIndex];
+
+    return burst->time - (double)process->burstCycles * configData->procCycleRate;
+}
+
+/**
+ * @details Handles output depending on logToCode.
+ *          If logToCode is MONITOR, prints string.
+ *          If logToCode is FILE, writes string to the log file.
+ *          If logToCode is BOTH, prints and writes string to the log file.
+ *          The log is only open when logToCode is FILE or BOTH.
+ *
+ * @param[in] logToCode Config data log to code
+ *
+ * @param[out] ouptutPtr Ouptut log
+ *
+ * @param[in] inputStr string to be outputted
+ */
+void outputLine(int logToCode, LogOutput *ouptutPtr, char *inputStr)
+{
+    appendLogString(ouptutPtr, inputStr);
+
+    if (logToCode != LOGTO_FILE_CODE)
+    {
+        printf("%s", inputStr);
     }
-    fclose(outputFile);
 }
 
 /**
@@ -1044,93 +1521,74 @@ void outputToFile(LogOutput *ouptutPtr, char *outputFileName)
  *
  * @param[in] configData Pointer to config data struct
  *
- * @param[out] ouptutPtr Ouptut linked list
- *
- * @return LogOutput Head of linked list
+ * @param[out] ouptutPtr Ouptut log
  */
-LogOutput *createLogFileHeader(ConfigDataType *configData, LogOutput *ouptutPtr)
+void createLogFileHeader(ConfigDataType *configData, LogOutput *ouptutPtr)
 {
     char tempStr[MAX_STR_LEN];
 
-    ouptutPtr = addNewStrNode(ouptutPtr, "==========================");
-    ouptutPtr = addNewStrNode(ouptutPtr, "=======================\n");
-    ouptutPtr = addNewStrNode(ouptutPtr, "Simulator Log File Header\n\n");
+    appendLogString(ouptutPtr, "==========================");
+    appendLogString(ouptutPtr, "=======================\n");
+    appendLogString(ouptutPtr, "Simulator Log File Header\n\n");
 
     sprintf(tempStr, "File Name                       : %s\n",
             configData->metaDataFileName);
 
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
+    appendLogString(ouptutPtr, tempStr);
 
     char cpuSchedCode[MAX_STR_LEN];
     configCodeToString(configData->cpuSchedCode, cpuSchedCode);
     sprintf(tempStr, "CPU Scheduling                  : %s\n", cpuSchedCode);
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
+    appendLogString(ouptutPtr, tempStr);
 
     sprintf(tempStr, "Quantum Cycles                  : %d\n",
             configData->quantumCycles);
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
+    appendLogString(ouptutPtr, tempStr);
 
     sprintf(tempStr, "Memory Available (KB)           : %d\n",
             configData->memAvailable);
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
+    appendLogString(ouptutPtr, tempStr);
 
     sprintf(tempStr, "Processor Cycle Rate (ms/cycle) : %d\n",
             configData->procCycleRate);
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
+    appendLogString(ouptutPtr, tempStr);
 
-    sprintf(tempStr, "I/O Cycle Rate (ms/cycle)       : %d\n\n",
+    sprintf(tempStr, "I/O Cycle Rate (ms/cycle)       : %d\n",
             configData->ioCycleRate);
-    ouptutPtr = addNewStrNode(ouptutPtr, tempStr);
-    return ouptutPtr;
-}
+    appendLogString(ouptutPtr, tempStr);
 
-/**
- * @brief Creates new LogOutput node.
- *
- * @details Checks if the local head pointer is NULL. If so, creates
- *          new node to be the head pointer. If not, adds new node to end of
- *          linked list.
- *
- * @param[in] head LogOutput head pointer
- *
- * @param[in] logString Ouptut string for new node
- *
- * @return LogOutput Head of linked list
- */
-LogOutput *addNewStrNode(LogOutput *head, char *logString)
-{
-    if (head == NULL)
+    char clockCode[MAX_STR_LEN];
+    configCodeToString(configData->clockCode, clockCode);
+    sprintf(tempStr, "Clock Mode                      : %s\n", clockCode);
+    appendLogString(ouptutPtr, tempStr);
+
+    if ((configData->cpuSchedCode == CPU_SCHED_PRIORITY_N_CODE) || (configData->cpuSchedCode == CPU_SCHED_PRIORITY_P_CODE))
     {
-        head = (LogOutput *)malloc(sizeof(LogOutput));
-        copyString(head->outputStr, logString);
-        head->next = NULL;
-        return head;
+        sprintf(tempStr, "Priority Aging Time (msec)      : %d\n",
+                configData->priorityAgingTime);
+        appendLogString(ouptutPtr, tempStr);
     }
-    // assume end of list not found yet
-    head->next = addNewStrNode(head->next, logString);
 
-    return head;
-}
+    if (configData->cpuSchedCode == CPU_SCHED_FAIR_P_CODE)
+    {
+        sprintf(tempStr, "Fair Target Latency (msec)      : %d\n",
+                configData->fairLatency);
+        appendLogString(ouptutPtr, tempStr);
 
-/**
- * @brief Clears LogOutput linked list.
- *
- * @details Recursively iterates through LogOutput linked list and
-           returns memory to OS from the bottom of the list upward.
- *
- * @param[in] head LogOutput head pointer
- *
- * @return LogOutput Head pointer, which should be NULL
- */
-LogOutput *clearLogOutput(LogOutput *head)
-{
-    if (head != NULL)
+        sprintf(tempStr, "Fair Min Granularity (msec)     : %d\n",
+                configData->fairGranularity);
+        appendLogString(ouptutPtr, tempStr);
+    }
+
+    if (configData->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE)
     {
-        if (head->next != NULL)
-        {
-            clearLogOutput(head->next);
-        }
-        free(head);
+        sprintf(tempStr, "MLFQ Levels                     : %d\n",
+                configData->mlfqLevels);
+        appendLogString(ouptutPtr, tempStr);
+
+        sprintf(tempStr, "MLFQ Boost Time (msec)          : %d\n",
+                configData->mlfqBoostTime);
+        appendLogString(ouptutPtr, tempStr);
     }
-    return NULL;
+    appendLogString(ouptutPtr, "\n");
 }
@@ -3,38 +3,37 @@
 #define SIM_UTILS_H
 
 #include "MetaDataAccess.h"
+#include "MetaDataImage.h"
+#include "ProcessStream.h"
 #include "ConfigAccess.h"
 #include "simtimer.h"
 #include "StringUtils.h"
-#include <pthread.h>
+#include "EventQueue.h"
+#include "Scheduler.h"
+#include "IOPool.h"
+#include "InterruptQueue.h"
+#include "LogWriter.h"
 
-// Buffer Structure
-typedef struct LogOutput
-{
-    char outputStr[200];
-    struct LogOutput *next;
-} LogOutput;
+// Value used for unused arguments and empty indices
+extern const int NA;
 
-// Thread input data structure
+// Timed op code, one per P, I, or O op a process runs
 typedef struct
 {
-    ConfigDataType *configData;
-    struct OpCodeType *opCode;
-    int processNum;
-    double cycleTime;
-    char outputStr[200];
-    pthread_mutex_t *mutexLock;
-} TimerRunnerStruct;
+    int cycles;        // op code value, read once instead of counted down
+    double time;       // ms the op code takes
+    double startTime;  // ms of every burst before it in its table
+} Burst;
 
-// Process States
-typedef enum
+// Bursts in op code order with running prefix sums
+// A process's run time so far is the difference of two startTimes, so
+// remaining time needs no walk over its op codes
+typedef struct
 {
-    NEW,
-    READY,
-    RUNNING,
-    BLOCKED,
-    EXIT
-} ProcessStates;
+    Burst *bursts;
+    int count;
+    int capacity;
+} BurstTable;
 
 // PCB Data Structure
 typedef struct ProcessControlBlock
@@ -42,10 +41,31 @@ typedef struct ProcessControlBlock
     int state;
     int number;
     struct OpCodeType *programCounter;
+    struct OpCodeType *opBlock;  // own op codes of a streamed process, else NULL
+    Burst *bursts;               // bursts from A(start) on
+    int burstIndex;              // burst the process runs next
+    int burstCycles;             // cycles of that burst already run
     double timeRemaining;
     double totalTime;
     int priority;
-    struct ProcessControlBlock *next;
+    int level;                   // MLFQ queue level, 0 is the top
+    long long vruntime;          // FAIR-P weighted run time, in us
+    long long pass;              // STRIDE-P pass
+    double cpuTime;              // ms run, ticket codes
+    double expectedCpuTime;      // ms its tickets were owed, ticket codes
+    double shareMark;            // owed ms per ticket when it began competing
+    double deadline;             // EDF-P admitted deadline in ms, else NA
+    double lateness;             // ms past the deadline it exited, < 0 if early
+    int heapIndex;
+    int bucket;
+    struct ProcessControlBlock *prevInBucket;
+    struct ProcessControlBlock *nextInBucket;
+    struct ProcessControlBlock *treeParent;
+    struct ProcessControlBlock *treeLeft;
+    struct ProcessControlBlock *treeRight;
+    int treeColor;
+    struct ProcessControlBlock *prevInQueue;
+    struct ProcessControlBlock *nextInQueue;
 } ProcessControlBlock;
 
 // Memory Structure
@@ -58,6 +78,15 @@ typedef struct MemoryNode
     struct MemoryNode *next;
 } MemoryNode;
 
+// Memory allocations of every process, in allocation order
+// Nodes come from a slab cache on the simulation arena
+typedef struct
+{
+    MemoryNode *head;
+    MemoryNode *tail;
+    SlabCache nodes;
+} MemoryList;
+
 // Memory Error, start at 3 to incorporate errors from StringUtils
 typedef enum
 {
@@ -68,58 +97,62 @@ typedef enum
 typedef enum
 {
     ADD_NODE,
-    DELETE_NODE,
     CHECK_FOR_INTERRUPTS,
     RESOLVE_INTERRUPTS,
-    CHECK_QUEUE,
+    SCHEDULE_INTERRUPT,
+    WAIT_FOR_INTERRUPTS,
+    CLEAR_INTERRUPTS,
 } SimManagerCodes;
 
-// Interrupt List
-typedef struct InterruptNode
-{
-    int processNum;
-    char outputStr[200];
-    int cycleTime;
-    struct InterruptNode *next;
-} InterruptNode;
-
 // Function Prototypes
-void *timerRunner(void *inputStruct);
-void runSim(struct OpCodeType *opCodes, ConfigDataType *configData);
-void createProcesses(OpCodeType *opCodes, ConfigDataType *configData,
-                     ProcessControlBlock *headPtr);
-ProcessControlBlock *addNewPCB(ProcessControlBlock *head, int number, int priority,
-                               OpCodeType *programCounter);
-ProcessControlBlock *runProcess(ProcessControlBlock *currentProcess, ConfigDataType *configData,
-                                LogOutput *ouptutPtr, MemoryNode *memoryPtr, ProcessControlBlock *headPtr);
+void runSim(struct OpCodeType *opCodes, MetaDataImage *image,
+            ProcessStream *stream, ConfigDataType *configData);
+int initialPriority(ConfigDataType *configData, int number, OpCodeType *processStart);
+void createProcesses(OpCodeType *opCodes, MetaDataImage *image,
+                     ConfigDataType *configData, BurstTable *burstTable,
+                     SchedulerType *scheduler);
+void createIndexedProcesses(MetaDataImage *image, ConfigDataType *configData,
+                            BurstTable *burstTable, SchedulerType *scheduler);
+void admitStreamedProcesses(ProcessStream *stream, ConfigDataType *configData,
+                            SchedulerType *scheduler);
+void releaseStreamedProcesses(SchedulerType *scheduler);
+void runProcess(ProcessControlBlock *currentProcess, ConfigDataType *configData,
+                LogOutput *ouptutPtr, MemoryList *memory, SchedulerType *scheduler,
+                IOPool *ioPool);
 double calcCycleTime(OpCodeType *opCodes, ConfigDataType *configData);
-void outputToFile(LogOutput *ouptutPtr, char *outputFileName);
-LogOutput *createLogFileHeader(ConfigDataType *configData,
-                               LogOutput *ouptutPtr);
-LogOutput *addNewStrNode(LogOutput *head, char *logString);
-LogOutput *clearLogOutput(LogOutput *head);
-LogOutput *outputLine(int logToCode, LogOutput *ouptutPtr, char *inputStr);
+double addBurst(BurstTable *burstTable, OpCodeType *opCode, ConfigDataType *configData);
+double addProcessBursts(BurstTable *burstTable, OpCodeType *processStart,
+                        ConfigDataType *configData);
+void clearBurstTable(BurstTable *burstTable);
+double remainingTime(ProcessControlBlock *process, ConfigDataType *configData);
+double nextBurstTime(ProcessControlBlock *process, ConfigDataType *configData);
+void createLogFileHeader(ConfigDataType *configData, LogOutput *ouptutPtr);
+void outputLine(int logToCode, LogOutput *ouptutPtr, char *inputStr);
 int memoryManager(ProcessControlBlock process, ConfigDataType *configData,
-                  LogOutput *ouptutPtr, MemoryNode *memoryPtr);
-MemoryNode *addNewMemoryNode(MemoryNode *head, int memoryID, int memoryBase,
-                             int memoryOffset, int processNum);
-Boolean requestMemory(MemoryNode *memoryPtr, int processNum, int identifier, int base, int offset);
-Boolean memorySpaceFree(MemoryNode *memoryPtr, int memoryBase, int processNum,
+                  LogOutput *ouptutPtr, MemoryList *memory);
+void initMemoryList(MemoryList *memory, Arena *arena);
+void addNewMemoryNode(MemoryList *memory, int memoryID, int memoryBase,
+                      int memoryOffset, int processNum);
+Boolean requestMemory(MemoryList *memory, int processNum, int identifier, int base, int offset);
+Boolean memorySpaceFree(MemoryList *memory, int memoryBase, int processNum,
                         int memoryIdentifier);
-MemoryNode *clearMemoryList(MemoryNode *head);
+void clearMemoryList(MemoryList *memory);
 
-ProcessControlBlock *findMinimum(ProcessControlBlock *headPtr, int schedCode);
-ProcessControlBlock *findNextReady(ProcessControlBlock *headPtr, int schedCode);
-ProcessControlBlock *selectNextProcess(ProcessControlBlock *headPtr, int schedCode);
-ProcessControlBlock *interruptManager(int interruptCode, int interruptedProcess, int processNum,
-                                      char *outputString, LogOutput *ouptutPtr, ConfigDataType *configData, ProcessControlBlock *headPtr, int cycleTime);
-InterruptNode *addNewInterruptNode(InterruptNode *head, int processNum, int cycleTime, char *outputString);
-ProcessControlBlock *getLastNode(ProcessControlBlock *head);
-Boolean allProcessesEnded(ProcessControlBlock *headPtr);
-Boolean waitingQueue(int code, int processNum);
-ProcessControlBlock *reorderPCBList(ProcessControlBlock *headPtr, int processNum);
-ProcessControlBlock *findPCB(ProcessControlBlock *headPtr, int processNum);
-ProcessControlBlock *clearPCBList(ProcessControlBlock *head);
-void *timerRunnerPremptive(void *inputStruct);
+ProcessControlBlock *selectNextProcess(SchedulerType *scheduler);
+void demoteProcess(ProcessControlBlock *process, ConfigDataType *configData,
+                   LogOutput *ouptutPtr, SchedulerType *scheduler);
+int fairSliceCycles(ConfigDataType *configData, SchedulerType *scheduler);
+void reportCpuShares(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler);
+void admitDeadlines(SchedulerType *scheduler);
+void reportAdmission(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler);
+void reportDeadlines(ConfigDataType *configData, LogOutput *ouptutPtr,
+                     SchedulerType *scheduler);
+Boolean interruptManager(int interruptCode, int interruptedProcess, int processNum,
+                         char *outputString, LogOutput *ouptutPtr, ConfigDataType *configData, int cycleTime,
+                         SchedulerType *scheduler);
+void postIOInterrupt(SimEvent *request);
+Boolean allProcessesEnded(SchedulerType *scheduler);
 
 #endif // SIM_UTILS_H
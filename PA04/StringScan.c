@@ -0,0 +1,570 @@
+// Header files
+#include <stdint.h>
+#include <string.h>
+
+#include "StringScan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+// Unaligned loads that stay inside one page cannot fault, even when they
+// run past the end of the string being scanned
+#define SCAN_PAGE_SIZE 4096
+
+// Scan implementations, one set per instruction set
+typedef int (*LengthScan)(const char *testStr, int limit);
+typedef int (*MismatchScan)(const char *oneStr, const char *otherStr,
+                            int limit);
+typedef int (*SubStringScan)(const char *testStr, int testLength,
+                             const char *searchStr, int searchLength);
+
+static int resolveLength(const char *testStr, int limit);
+static int resolveMismatch(const char *oneStr, const char *otherStr, int limit);
+static int resolveSubString(const char *testStr, int testLength,
+                            const char *searchStr, int searchLength);
+
+// Point at the resolvers until the first call picks the implementations
+static LengthScan lengthScan = resolveLength;
+static MismatchScan mismatchScan = resolveMismatch;
+static SubStringScan subStringScan = resolveSubString;
+
+/**
+ * @details Byte at a time length scan.
+ *
+ * @param[in] testStr String to scan
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the null character, limit if not reached
+ */
+static int scalarLength(const char *testStr, int limit)
+{
+    int index = 0;
+
+    while (index < limit && testStr[index] != '\0')
+    {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @details Byte at a time mismatch scan.
+ *
+ * @param[in] oneStr String to scan
+ *
+ * @param[in] otherStr String compared against
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the first differing character or of the end of
+ *             oneStr, limit if neither is reached
+ */
+static int scalarMismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    int index = 0;
+
+    while (index < limit && oneStr[index] != '\0'
+                         && oneStr[index] == otherStr[index])
+    {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @details Checks every start position in turn.
+ *
+ * @param[in] testStr Characters to search
+ *
+ * @param[in] testLength Number of characters to search
+ *
+ * @param[in] searchStr Characters to find, at least one
+ *
+ * @param[in] searchLength Number of characters to find
+ *
+ * @return int Index of the first match, SCAN_NOT_FOUND if none
+ */
+static int scalarSubString(const char *testStr, int testLength,
+                           const char *searchStr, int searchLength)
+{
+    int start;
+
+    for (start = 0; start + searchLength <= testLength; start++)
+    {
+        if (testStr[start] == searchStr[0]
+            && memcmp(testStr + start, searchStr, searchLength) == 0)
+        {
+            return start;
+        }
+    }
+    return SCAN_NOT_FOUND;
+}
+
+#ifdef SCAN_X86
+
+/**
+ * @details Reports whether a vector load at this address stays in its page.
+ *
+ * @param[in] address Load address
+ *
+ * @param[in] width Load width in bytes
+ *
+ * @return int Non-zero if the load cannot fault
+ */
+static int blockReadable(const char *address, int width)
+{
+    return ((uintptr_t)address & (SCAN_PAGE_SIZE - 1))
+               <= (uintptr_t)(SCAN_PAGE_SIZE - width);
+}
+
+/**
+ * @details Checks each position flagged by the first/last character
+ *          filter against the middle of the search string.
+ *
+ * @param[in] mask One bit per start position whose first and last
+ *                 characters matched
+ *
+ * @param[in] testStr Characters to search
+ *
+ * @param[in] base Start position of bit zero
+ *
+ * @param[in] searchStr Characters to find
+ *
+ * @param[in] searchLength Number of characters to find
+ *
+ * @return int Index of the first match, SCAN_NOT_FOUND if none
+ */
+static int verifyCandidates(unsigned int mask, const char *testStr, int base,
+                            const char *searchStr, int searchLength)
+{
+    int start;
+
+    while (mask != 0)
+    {
+        start = base + __builtin_ctz(mask);
+        // The filter already matched strings of two or fewer characters
+        if (searchLength <= 2
+            || memcmp(testStr + start + 1, searchStr + 1, searchLength - 2) == 0)
+        {
+            return start;
+        }
+        mask &= mask - 1;
+    }
+    return SCAN_NOT_FOUND;
+}
+
+/**
+ * @details Length scan, 16 characters per compare. Loads may read past
+ *          the null character inside its page, which the address
+ *          sanitizer would report.
+ *
+ * @param[in] testStr String to scan
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the null character, limit if not reached
+ */
+__attribute__((target("sse2"), no_sanitize_address))
+static int sse2Length(const char *testStr, int limit)
+{
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int mask;
+    int index = 0;
+
+    while (index < limit)
+    {
+        if (!blockReadable(testStr + index, 16))
+        {
+            if (testStr[index] == '\0')
+            {
+                return index;
+            }
+            index++;
+            continue;
+        }
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_loadu_si128((const __m128i *)(testStr + index)), zero));
+        if (mask != 0)
+        {
+            index += __builtin_ctz(mask);
+            return (index < limit) ? index : limit;
+        }
+        index += 16;
+    }
+    return limit;
+}
+
+/**
+ * @details Mismatch scan, 16 characters per compare.
+ *
+ * @param[in] oneStr String to scan
+ *
+ * @param[in] otherStr String compared against
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the first differing character or of the end of
+ *             oneStr, limit if neither is reached
+ */
+__attribute__((target("sse2"), no_sanitize_address))
+static int sse2Mismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i oneBlock;
+    __m128i otherBlock;
+    unsigned int mask;
+    int index = 0;
+
+    while (index < limit)
+    {
+        if (!blockReadable(oneStr + index, 16)
+            || !blockReadable(otherStr + index, 16))
+        {
+            if (oneStr[index] == '\0' || oneStr[index] != otherStr[index])
+            {
+                return index;
+            }
+            index++;
+            continue;
+        }
+        oneBlock = _mm_loadu_si128((const __m128i *)(oneStr + index));
+        otherBlock = _mm_loadu_si128((const __m128i *)(otherStr + index));
+        mask = (~_mm_movemask_epi8(_mm_cmpeq_epi8(oneBlock, otherBlock)) & 0xFFFF)
+               | _mm_movemask_epi8(_mm_cmpeq_epi8(oneBlock, zero));
+        if (mask != 0)
+        {
+            index += __builtin_ctz(mask);
+            return (index < limit) ? index : limit;
+        }
+        index += 16;
+    }
+    return limit;
+}
+
+/**
+ * @details Substring search that compares the first and last search
+ *          characters against 16 start positions at once and only
+ *          verifies the positions where both match.
+ *
+ * @param[in] testStr Characters to search
+ *
+ * @param[in] testLength Number of characters to search
+ *
+ * @param[in] searchStr Characters to find, at least one
+ *
+ * @param[in] searchLength Number of characters to find
+ *
+ * @return int Index of the first match, SCAN_NOT_FOUND if none
+ */
+__attribute__((target("sse2")))
+static int sse2SubString(const char *testStr, int testLength,
+                         const char *searchStr, int searchLength)
+{
+    const __m128i first = _mm_set1_epi8(searchStr[0]);
+    const __m128i last = _mm_set1_epi8(searchStr[searchLength - 1]);
+    int positions = testLength - searchLength + 1;
+    unsigned int mask;
+    int start = 0;
+    int found;
+
+    // Both loads stay inside the test characters
+    while (start + 16 <= positions)
+    {
+        mask = _mm_movemask_epi8(_mm_and_si128(
+                   _mm_cmpeq_epi8(first,
+                       _mm_loadu_si128((const __m128i *)(testStr + start))),
+                   _mm_cmpeq_epi8(last,
+                       _mm_loadu_si128((const __m128i *)
+                                       (testStr + start + searchLength - 1)))));
+        found = verifyCandidates(mask, testStr, start, searchStr, searchLength);
+        if (found != SCAN_NOT_FOUND)
+        {
+            return found;
+        }
+        start += 16;
+    }
+
+    // Fewer than 16 start positions in all, too short for one compare
+    if (start == 0)
+    {
+        return scalarSubString(testStr, testLength, searchStr, searchLength);
+    }
+
+    // One last compare ending at the final start position, dropping the
+    // positions the loop already checked
+    if (start < positions)
+    {
+        mask = _mm_movemask_epi8(_mm_and_si128(
+                   _mm_cmpeq_epi8(first,
+                       _mm_loadu_si128((const __m128i *)(testStr + positions - 16))),
+                   _mm_cmpeq_epi8(last,
+                       _mm_loadu_si128((const __m128i *)
+                                       (testStr + positions - 16 + searchLength - 1)))));
+        mask &= ~0u << (start + 16 - positions);
+        return verifyCandidates(mask, testStr, positions - 16, searchStr, searchLength);
+    }
+    return SCAN_NOT_FOUND;
+}
+
+/**
+ * @details Length scan, 32 characters per compare.
+ *
+ * @param[in] testStr String to scan
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the null character, limit if not reached
+ */
+__attribute__((target("avx2"), no_sanitize_address))
+static int avx2Length(const char *testStr, int limit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned int mask;
+    int index = 0;
+
+    while (index < limit)
+    {
+        if (!blockReadable(testStr + index, 32))
+        {
+            if (testStr[index] == '\0')
+            {
+                return index;
+            }
+            index++;
+            continue;
+        }
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                   _mm256_loadu_si256((const __m256i *)(testStr + index)), zero));
+        if (mask != 0)
+        {
+            index += __builtin_ctz(mask);
+            return (index < limit) ? index : limit;
+        }
+        index += 32;
+    }
+    return limit;
+}
+
+/**
+ * @details Mismatch scan, 32 characters per compare.
+ *
+ * @param[in] oneStr String to scan
+ *
+ * @param[in] otherStr String compared against
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the first differing character or of the end of
+ *             oneStr, limit if neither is reached
+ */
+__attribute__((target("avx2"), no_sanitize_address))
+static int avx2Mismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i oneBlock;
+    __m256i otherBlock;
+    unsigned int mask;
+    int index = 0;
+
+    while (index < limit)
+    {
+        if (!blockReadable(oneStr + index, 32)
+            || !blockReadable(otherStr + index, 32))
+        {
+            if (oneStr[index] == '\0' || oneStr[index] != otherStr[index])
+            {
+                return index;
+            }
+            index++;
+            continue;
+        }
+        oneBlock = _mm256_loadu_si256((const __m256i *)(oneStr + index));
+        otherBlock = _mm256_loadu_si256((const __m256i *)(otherStr + index));
+        mask = ~(unsigned int)_mm256_movemask_epi8(
+                   _mm256_cmpeq_epi8(oneBlock, otherBlock))
+               | (unsigned int)_mm256_movemask_epi8(
+                   _mm256_cmpeq_epi8(oneBlock, zero));
+        if (mask != 0)
+        {
+            index += __builtin_ctz(mask);
+            return (index < limit) ? index : limit;
+        }
+        index += 32;
+    }
+    return limit;
+}
+
+/**
+ * @details Substring search that compares the first and last search
+ *          characters against 32 start positions at once and only
+ *          verifies the positions where both match.
+ *
+ * @param[in] testStr Characters to search
+ *
+ * @param[in] testLength Number of characters to search
+ *
+ * @param[in] searchStr Characters to find, at least one
+ *
+ * @param[in] searchLength Number of characters to find
+ *
+ * @return int Index of the first match, SCAN_NOT_FOUND if none
+ */
+__attribute__((target("avx2")))
+static int avx2SubString(const char *testStr, int testLength,
+                         const char *searchStr, int searchLength)
+{
+    const __m256i first = _mm256_set1_epi8(searchStr[0]);
+    const __m256i last = _mm256_set1_epi8(searchStr[searchLength - 1]);
+    int positions = testLength - searchLength + 1;
+    unsigned int mask;
+    int start = 0;
+    int found;
+
+    // Both loads stay inside the test characters
+    while (start + 32 <= positions)
+    {
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+                   _mm256_cmpeq_epi8(first,
+                       _mm256_loadu_si256((const __m256i *)(testStr + start))),
+                   _mm256_cmpeq_epi8(last,
+                       _mm256_loadu_si256((const __m256i *)
+                                          (testStr + start + searchLength - 1)))));
+        found = verifyCandidates(mask, testStr, start, searchStr, searchLength);
+        if (found != SCAN_NOT_FOUND)
+        {
+            return found;
+        }
+        start += 32;
+    }
+
+    // Fewer than 32 start positions in all, the 16 wide search takes them
+    if (start == 0)
+    {
+        return sse2SubString(testStr, testLength, searchStr, searchLength);
+    }
+
+    // One last compare ending at the final start position, dropping the
+    // positions the loop already checked
+    if (start < positions)
+    {
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+                   _mm256_cmpeq_epi8(first,
+                       _mm256_loadu_si256((const __m256i *)(testStr + positions - 32))),
+                   _mm256_cmpeq_epi8(last,
+                       _mm256_loadu_si256((const __m256i *)
+                                          (testStr + positions - 32 + searchLength - 1)))));
+        mask &= ~0u << (start + 32 - positions);
+        return verifyCandidates(mask, testStr, positions - 32, searchStr, searchLength);
+    }
+    return SCAN_NOT_FOUND;
+}
+
+#endif // SCAN_X86
+
+/**
+ * @brief Picks the scan implementations.
+ *
+ * @details Uses the widest instruction set the processor supports,
+ *          falling back to the byte at a time scans. Threads racing
+ *          through here store the same choice.
+ */
+static void selectScans(void)
+{
+    LengthScan length = scalarLength;
+    MismatchScan mismatch = scalarMismatch;
+    SubStringScan subString = scalarSubString;
+
+#ifdef SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        length = avx2Length;
+        mismatch = avx2Mismatch;
+        subString = avx2SubString;
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        length = sse2Length;
+        mismatch = sse2Mismatch;
+        subString = sse2SubString;
+    }
+#endif
+
+    __atomic_store_n(&lengthScan, length, __ATOMIC_RELAXED);
+    __atomic_store_n(&mismatchScan, mismatch, __ATOMIC_RELAXED);
+    __atomic_store_n(&subStringScan, subString, __ATOMIC_RELAXED);
+}
+
+static int resolveLength(const char *testStr, int limit)
+{
+    selectScans();
+    return scanStringLength(testStr, limit);
+}
+
+static int resolveMismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    selectScans();
+    return scanStringMismatch(oneStr, otherStr, limit);
+}
+
+static int resolveSubString(const char *testStr, int testLength,
+                            const char *searchStr, int searchLength)
+{
+    selectScans();
+    return scanSubString(testStr, testLength, searchStr, searchLength);
+}
+
+/**
+ * @brief Finds the end of a string.
+ *
+ * @param[in] testStr String to scan
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the null character, limit if not reached
+ */
+int scanStringLength(const char *testStr, int limit)
+{
+    return __atomic_load_n(&lengthScan, __ATOMIC_RELAXED)(testStr, limit);
+}
+
+/**
+ * @brief Finds where two strings stop matching.
+ *
+ * @param[in] oneStr String to scan
+ *
+ * @param[in] otherStr String compared against
+ *
+ * @param[in] limit Maximum number of characters to scan
+ *
+ * @return int Index of the first differing character or of the end of
+ *             oneStr, limit if neither is reached
+ */
+int scanStringMismatch(const char *oneStr, const char *otherStr, int limit)
+{
+    return __atomic_load_n(&mismatchScan, __ATOMIC_RELAXED)(oneStr, otherStr,
+                                                            limit);
+}
+
+/**
+ * @brief Finds the first occurrence of one character run in another.
+ *
+ * @param[in] testStr Characters to search
+ *
+ * @param[in] testLength Number of characters to search
+ *
+ * @param[in] searchStr Characters to find, at least one
+ *
+ * @param[in] searchLength Number of characters to find
+ *
+ * @return int Index of the first match, SCAN_NOT_FOUND if none
+ */
+int scanSubString(const char *testStr, int testLength,
+                  const char *searchStr, int searchLength)
+{
+    return __atomic_load_n(&subStringScan, __ATOMIC_RELAXED)(
+               testStr, testLength, searchStr, searchLength);
+}
@@ -0,0 +1,14 @@
+// Pre-compiler directive
+#ifndef STRING_SCAN_H
+#define STRING_SCAN_H
+
+// Returned by scanSubString when the search string does not occur
+#define SCAN_NOT_FOUND -1
+
+// Function Prototypes
+int scanStringLength(const char *testStr, int limit);
+int scanStringMismatch(const char *oneStr, const char *otherStr, int limit);
+int scanSubString(const char *testStr, int testLength,
+                  const char *searchStr, int searchLength);
+
+#endif // STRING_SCAN_H
@@ -1,5 +1,8 @@
 // header files
+#include <string.h>
+
 #include "StringUtils.h"
+#include "StringScan.h"
 
 // global constants
 const int MAX_STR_LEN = 200;
@@ -11,6 +14,7 @@ const char SPACE = ' ';
 const char COLON = ':';
 const char PERIOD = '.';
 const char SEMICOLON = ';';
+const char COMMA = ',';
 const char LEFT_PAREN = '(';
 const char RIGHT_PAREN = ')';
 const Boolean IGNORE_LEADING_WS = True;
@@ -18,7 +22,8 @@ const Boolean ACCEPT_LEADING_WS = False;
 
 /*
 Function name: 	getStringLength
-Algorithm: 		find the length of the string, up to the null character
+Algorithm: 		find the length of the string, up to the null character,
+				scanning a vector of characters at a time
 Precondition: 	gives C-style with null character at end
 Postcondition: 	return the number of characters from the beginning
 			   	up to the null character
@@ -27,19 +32,9 @@ Note: limit test loop to maximum characters for safety
  */
 int getStringLength( char *testStr )
    {
-	 // initialize function/variables
-	int index = 0;
-
-	 // loop up to null character or limit
-	while( index < MAX_STR_LEN && testStr[ index ] != NULL_CHAR )
-	   {
-		// increment the counter index
-	    index++;
-	   }
-	// end loop
-
-	// return the counter index value
-	return index;
+	 // find the null character, up to the limit
+		// function: scanStringLength
+	return scanStringLength( testStr, MAX_STR_LEN );
    }
 
 /*
@@ -54,20 +49,19 @@ Note: limit test loop to maximum characters for safety
 void copyString( char *destination, char *source )
    {
 	 // initialize function/variables
-    int index = 0;
+		// function: getStringLength
+    int length = getStringLength( source );
 
-	 // loop until null character is found in source string
-	 //   loop limits to MAX_STR_LEN
-    while( index < MAX_STR_LEN && source[ index ] != NULL_CHAR )
+	 // check for characters to copy, an empty source leaves
+	 //   destination unchanged
+    if( length > 0 )
       {
-		 // assign source character to destination element
-       destination[ index ] = source[ index ];
-
-		 // increment index
-       index++;
+		 // copy source characters to destination
+			// function: memmove
+       memmove( destination, source, length );
 
 		 // assign null character to next destination element
-       destination[ index ] = NULL_CHAR;
+       destination[ length ] = NULL_CHAR;
       }
    }
 
@@ -88,23 +82,22 @@ void concatenateString( char *destination, char *source )
    	// initialize function/variables
 
    		// set destination index to length of destination string
+   			// function: getStringLength
          int destIndex = getStringLength( destination );
 
-   		// set source index to zero
-         int srcIndex = 0;
+   		// set source length, limited to MAX_STR_LEN
+   			// function: getStringLength
+         int srcLength = getStringLength( source );
 
-   	// loop to end of source index (null character)
-   	//   loop limited to MAX_STR_LEN
-      while( srcIndex < MAX_STR_LEN && source[ srcIndex ] != NULL_CHAR )
+   	// check for characters to append
+      if( srcLength > 0 )
       {
-   		// assign source character to destination at destination index
-         destination[ destIndex ] = source[ srcIndex ];
-
-   		// increment source and destination indices;
-         destIndex++; srcIndex++;
+   		// copy source characters to end of destination
+   			// function: memmove
+         memmove( destination + destIndex, source, srcLength );
 
    		// assign null character to next destination element
-         destination[ destIndex ] = NULL_CHAR;
+         destination[ destIndex + srcLength ] = NULL_CHAR;
       }
    }
 
@@ -126,26 +119,19 @@ Note: limit test loop to maximum characters for safety
 int compareString( char *oneStr, char *otherStr )
    {
    	// initialize function/variables
-      int index = 0;
-      int difference;
-   	// loop to end of one of the two strings
-   	//   loop limited to MAX_STR_LEN
-      while( index < MAX_STR_LEN && oneStr[ index ] != NULL_CHAR
+
+   		// find first differing character or end of one string
+   		//   scan limited to MAX_STR_LEN
+   			// function: scanStringMismatch
+      int index = scanStringMismatch( oneStr, otherStr, MAX_STR_LEN );
+
+   	// check for differing characters before either string ended
+      if( index < MAX_STR_LEN && oneStr[ index ] != NULL_CHAR
                                     && otherStr[ index ] != NULL_CHAR )
       {
-   		// find the difference between the currently aligned characters
-         difference = oneStr[ index ] - otherStr[ index ];
-
-   		// check for non-zero difference
-         if( difference != 0 )
-         {
-   			// return non-zero difference
-            return difference;
-         }
-   		// increment index
-         index++;
+   		// return non-zero difference
+         return oneStr[ index ] - otherStr[ index ];
       }
-   	// end loop
 
    	// assume strings are equal at this point, return string length difference
    		// function: getStringLength
@@ -216,7 +202,9 @@ void getSubString( char *destStr, char *sourceStr,
 
 /*
 Function name: 	findSubString
-Algorithm: 		linear search for given substring within a given test string
+Algorithm: 		vector search for given substring within a given test string,
+				filtering start positions on the first and last substring
+				characters before comparing the rest
 Precondition: 	given C-style source string, having a null character ('\0') at
 			  	end of string, and given search string with a null character
 			  	('\n') at end of that string
@@ -231,36 +219,30 @@ int findSubString( char *testStr, char *searchSubStr )
 		// initialize test string length
    int testStrLen = getStringLength( testStr );
 
-   int masterIndex = 0;
+		// a match may end on the character at the length limit,
+		//   so the search covers one character past it
+   int searchLimit = testStrLen + 1;
 
-   int searchIndex, internalIndex;
+		// initialize substring length, past the search limit
+		//   means the substring cannot fit
+			// function: scanStringLength
+   int searchStrLen = scanStringLength( searchSubStr, searchLimit + 1 );
 
-	// loop across test string
-   while( masterIndex < testStrLen )
-   {
-		// set internal loop index to current test string index
-      internalIndex = masterIndex;
+   int foundIndex;
 
-		// set internal search index to zero
-      searchIndex = 0;
+	// check for empty or oversized substring
+   if( searchStrLen == 0 || searchStrLen > searchLimit )
+   {
+      return SUBSTRING_NOT_FOUND;
+   }
 
-		// loop to end of test string
-		//   while test string/sub string characters are the same
-      while( internalIndex <= testStrLen
-                  && testStr[ internalIndex ] == searchSubStr[ searchIndex ] )
-      {
-			// increment test string, substring indices
-         internalIndex++; searchIndex++;
-
-			// check for end of substring (search completed)
-         if( searchSubStr[ searchIndex ] == NULL_CHAR )
-         {
-				// return current test string index
-            return masterIndex;
-         }
-      }
-		// increment current test string index
-      masterIndex++;
+	// search test string, only matches starting inside it count
+		// function: scanSubString
+   foundIndex = scanSubString( testStr, searchLimit,
+                                          searchSubStr, searchStrLen );
+   if( foundIndex != SCAN_NOT_FOUND && foundIndex < testStrLen )
+   {
+      return foundIndex;
    }
    return SUBSTRING_NOT_FOUND;
 }
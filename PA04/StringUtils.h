@@ -23,6 +23,7 @@ extern const char SPACE;
 extern const char COLON;
 extern const char PERIOD;
 extern const char SEMICOLON;
+extern const char COMMA;
 extern const char LEFT_PAREN;
 extern const char RIGHT_PAREN;
 extern const Boolean IGNORE_LEADING_WS;
@@ -0,0 +1,126 @@
+// Header files
+#include <stdlib.h>
+
+#include "TicketTree.h"
+
+// Index count of the first allocation, a power of two
+static const int INITIAL_TICKET_CAPACITY = 16;
+
+static void growTicketTree(TicketTree *tree, int index)
+{
+    int capacity = (tree->capacity == 0) ? INITIAL_TICKET_CAPACITY : tree->capacity;
+    int position;
+    int parent;
+
+    while (capacity <= index)
+    {
+        capacity *= 2;
+    }
+
+    tree->tickets = (int *)realloc(tree->tickets, capacity * sizeof(int));
+    tree->sums = (long long *)realloc(tree->sums, (capacity + 1) * sizeof(long long));
+    for (position = tree->capacity; position < capacity; position++)
+    {
+        tree->tickets[position] = 0;
+    }
+    tree->capacity = capacity;
+
+    // Rebuild every partial sum in one pass, each adding into its parent
+    for (position = 1; position <= capacity; position++)
+    {
+        tree->sums[position] = tree->tickets[position - 1];
+    }
+    for (position = 1; position <= capacity; position++)
+    {
+        parent = position + (position & -position);
+        if (parent <= capacity)
+        {
+            tree->sums[parent] += tree->sums[position];
+        }
+    }
+}
+
+/**
+ * @brief Initializes an empty ticket tree.
+ *
+ * @param[out] tree Tree to initialize
+ */
+void initTicketTree(TicketTree *tree)
+{
+    tree->sums = NULL;
+    tree->tickets = NULL;
+    tree->capacity = 0;
+    tree->total = 0;
+}
+
+/**
+ * @details Sets the tickets held at an index, growing the tree if the
+ *          index is past its end. O(log n), O(n) when it grows.
+ *
+ * @param[in] tree Ticket tree
+ *
+ * @param[in] index Process table slot
+ *
+ * @param[in] tickets Tickets in the draw, 0 to leave it
+ */
+void ticketSet(TicketTree *tree, int index, int tickets)
+{
+    int position;
+    int delta;
+
+    if (index >= tree->capacity)
+    {
+        growTicketTree(tree, index);
+    }
+
+    delta = tickets - tree->tickets[index];
+    tree->tickets[index] = tickets;
+    tree->total += delta;
+
+    for (position = index + 1; position <= tree->capacity; position += position & -position)
+    {
+        tree->sums[position] += delta;
+    }
+}
+
+/**
+ * @brief Finds the holder of a drawn ticket.
+ *
+ * @details Tickets are numbered across the indices in order, so the
+ *          holder is the first index whose running total passes the
+ *          draw. The search descends the implicit tree from its largest
+ *          power of two. O(log n).
+ *
+ * @param[in] tree Ticket tree
+ *
+ * @param[in] draw Ticket number, 0 to total - 1
+ *
+ * @return int Index holding the ticket
+ */
+int ticketDraw(TicketTree *tree, long long draw)
+{
+    int position = 0;
+    int step;
+
+    for (step = tree->capacity; step > 0; step /= 2)
+    {
+        if (position + step <= tree->capacity && tree->sums[position + step] <= draw)
+        {
+            position += step;
+            draw -= tree->sums[position];
+        }
+    }
+    return position;
+}
+
+/**
+ * @brief Releases the ticket tree.
+ *
+ * @param[in] tree Ticket tree
+ */
+void clearTicketTree(TicketTree *tree)
+{
+    free(tree->sums);
+    free(tree->tickets);
+    initTicketTree(tree);
+}
@@ -0,0 +1,23 @@
+// Pre-compiler directive
+#ifndef TICKET_TREE_H
+#define TICKET_TREE_H
+
+// Fenwick (binary indexed) tree of lottery tickets
+// Index i holds the tickets of process table slot i, 0 when that process
+// is not in the draw. sums is 1-based and capacity is a power of two, so
+// a draw walks down one bit at a time
+typedef struct
+{
+    long long *sums;
+    int *tickets;
+    int capacity;
+    long long total;
+} TicketTree;
+
+// Function Prototypes
+void initTicketTree(TicketTree *tree);
+void ticketSet(TicketTree *tree, int index, int tickets);
+int ticketDraw(TicketTree *tree, long long draw);
+void clearTicketTree(TicketTree *tree);
+
+#endif // TICKET_TREE_H
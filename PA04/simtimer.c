@@ -29,12 +29,28 @@
 
 const char RADIX_POINT = '.';
 
+static const long long NANO_PER_MILLI = 1000000LL;
+static const long long NANO_PER_MICRO = 1000LL;
+static const long long NANO_PER_SEC = 1000000000LL;
+
+// Virtual clock state, only used in VIRTUAL_TIMER_MODE
+static int timerMode = REAL_TIMER_MODE;
+static long long virtualNanoSec = 0;
+
 void runTimer( int milliSeconds )
    {
     struct timeval startTime, endTime;
     int startSec, startUSec, endSec, endUSec;
     int uSecDiff, mSecDiff, secDiff, timeDiff;
 
+    // virtual clock jumps ahead instead of waiting on the wall clock
+    if( timerMode == VIRTUAL_TIMER_MODE )
+       {
+        virtualNanoSec += milliSeconds * NANO_PER_MILLI;
+
+        return;
+       }
+
     gettimeofday( &startTime, NULL );
 
     startSec = startTime.tv_sec;
@@ -71,6 +87,20 @@ double accessTimer( int controlCode, char *timeStr )
     struct timeval startData, lapData, endData;
     double fpTime = 0.0;
 
+    if( timerMode == VIRTUAL_TIMER_MODE )
+       {
+        if( controlCode == ZERO_TIMER )
+           {
+            virtualNanoSec = 0;
+           }
+
+        timeToString( (int) ( virtualNanoSec / NANO_PER_SEC ),
+                      (int) ( ( virtualNanoSec % NANO_PER_SEC )
+                                                   / NANO_PER_MICRO ), timeStr );
+
+        return (double) virtualNanoSec / NANO_PER_SEC;
+       }
+
     switch( controlCode )
        {
         case ZERO_TIMER:
@@ -223,6 +253,33 @@ void timeToString( int secTime, int uSecTime, char *timeStr )
        }
    }
 
+/* Selects between the wall-clock timer and the discrete-event virtual
+   clock; in virtual mode runTimer advances simulated time immediately
+   and accessTimer reports simulated rather than elapsed time
+*/
+void setTimerMode( int modeCode )
+   {
+    timerMode = modeCode;
+
+    virtualNanoSec = 0;
+   }
+
+long long getTimerNanoSec( void )
+   {
+    return virtualNanoSec;
+   }
+
+/* Jumps the virtual clock forward to the given event time;
+   the clock never moves backward
+*/
+void advanceTimerTo( long long nanoSec )
+   {
+    if( nanoSec > virtualNanoSec )
+       {
+        virtualNanoSec = nanoSec;
+       }
+   }
+
 #endif // ifndef SIMTIMER_C
 
 
@@ -31,6 +31,8 @@
 
 enum TIMER_CTRL_CODES { ZERO_TIMER, LAP_TIMER, STOP_TIMER };
 
+enum TIMER_MODE_CODES { REAL_TIMER_MODE, VIRTUAL_TIMER_MODE };
+
 extern const char RADIX_POINT;
 extern const char SPACE;
 
@@ -41,6 +43,9 @@ double accessTimer( int controlCode, char *timeStr );
 double processTime( double startSec, double endSec,
                            double startUSec, double endUSec, char *timeStr );
 void timeToString( int secTime, int uSecTime, char *timeStr );
+void setTimerMode( int modeCode );
+long long getTimerNanoSec( void );
+void advanceTimerTo( long long nanoSec );
 
 #endif // ifndef SIMTIMER_H
 